@@ -24,6 +24,7 @@ namespace sweetPyTest {
         subject.add_static_method("GetUniqueMe", "GetUniqueMe - Return an rvalue reference of non supported type", &TestSubjectA::GetUniqueMe);
         subject.add_static_method("Setter", "Setter - will change the value of m_valid into true", &TestSubjectA::Setter);
         subject.add_static_method("Getter", "Getter - will retrieve m_valid", &TestSubjectA::Getter);
+        subject.add_static_method("GetterReleased", "Getter - will retrieve m_valid, invoked without the GIL", &TestSubjectA::Getter, release_gil);
         subject.add_static_method("BMutator", "Mutates received TestSubjectB instance", &TestSubjectA::BMutator);
         subject.add_member("byValueInt", &TestSubjectA::m_byValueInt, "int by value member support");
         subject.add_member("ctypeStr", &TestSubjectA::m_ctypeStr, "c-type string member support");
@@ -33,16 +34,27 @@ namespace sweetPyTest {
         subject.add_method("FromStrVectorToIntVector", "Will transform str vector to int vector", &TestSubjectA::FromStrVectorToIntVector);
 
         Clazz<TestSubjectB> subjectB(module, "TestClassB", "TestClassB");
+        subjectB.enable_free_list(16);
         subjectB.add_method("IncValue", "Will increase b internal ref count", &TestSubjectB::IncValue);
         subjectB.add_member("value", &TestSubjectB::m_value, "value");
         subjectB.add_member("str", &TestSubjectB::m_str, "str");
         subjectB.add_method("Foo_1", "Foo function", static_cast<int(TestSubjectB::*)(int)>(&TestSubjectB::Foo));
         subjectB.add_method("Foo_2", "Foo function", static_cast<int(TestSubjectB::*)(int, int)>(&TestSubjectB::Foo));
+        subjectB.add_method("Foo", "Foo function", static_cast<int(TestSubjectB::*)(int)>(&TestSubjectB::Foo));
+        subjectB.add_method("Foo", "Foo function", static_cast<int(TestSubjectB::*)(int, int)>(&TestSubjectB::Foo));
+        subjectB.add_method("Sum", "Sum function", &TestSubjectB::Sum);
+        subjectB.add_method("Foo_released", "Foo function, invoked without the GIL", static_cast<int(TestSubjectB::*)(int)>(&TestSubjectB::Foo), release_gil);
         
         Enum enumSubject(module, "Enum_Python");
         enumSubject.add_value("Good", (int)Python::Good);
         enumSubject.add_value("Bad", (int)Python::Bad);
 
+        Clazz<AlignedSubject> alignedSubject(module, "AlignedClass", "An over aligned class");
+        alignedSubject.add_constructor<>();
+        alignedSubject.add_method("is_aligned", "checks the instance's alignment", &AlignedSubject::IsAligned);
+        alignedSubject.add_method("copy", "returns a copy by value", &AlignedSubject::Copy);
+        alignedSubject.add_member("value", &AlignedSubject::m_value, "value");
+
         Clazz<TestSubjectC> subjectC(module, "TestClassC", "A non copyable/moveable version for a class");
         subjectC.add_constructor<TestSubjectC&&>();
         subjectC.add_method("inc", "will increase i", &TestSubjectC::Inc);
@@ -94,6 +106,21 @@ namespace sweetPyTest {
         ctypestrConstRefType.add_method("create", "Will generate c-type str const ref", static_cast<const char*&(GenerateRefTypes<const char*>::*)(const char*&)>(&GenerateRefTypes<const char*>::operator()));
         
         module.add_function("globalFunction", "global function", &globalFunction);
+        module.add_function("is_gil_held", "checks whether the GIL is held", &IsGilHeld);
+        module.add_function("is_gil_held_released", "checks whether the GIL is held, invoked without the GIL", &IsGilHeld, release_gil);
+        module.add_function("describe", "describes the provided arguments", static_cast<std::string(*)(int)>(&Describe));
+        module.add_function("describe", "describes the provided arguments", static_cast<std::string(*)(const std::string&)>(&Describe));
+        module.add_function("describe", "describes the provided arguments", static_cast<std::string(*)(int, int)>(&Describe));
+        module.add_function("classify", "classifies the provided argument", static_cast<std::string(*)(char*)>(&Classify));
+        module.add_function("classify", "classifies the provided argument", static_cast<std::string(*)(long)>(&Classify));
+        module.add_function("classify", "classifies the provided argument", static_cast<std::string(*)(const char*)>(&Classify));
+        module.add_function("narrow_short", "converts the argument into a short", &Narrow<short>);
+        module.add_function("narrow_char", "converts the argument into a char", &Narrow<char>);
+        module.add_function("narrow_uint8", "converts the argument into an uint8_t", &Narrow<std::uint8_t>);
+        module.add_function("narrow_unsigned", "converts the argument into an unsigned", &Narrow<unsigned>);
+        module.add_function("narrow_uint64", "converts the argument into an uint64_t", &Narrow<std::uint64_t>);
+        module.add_function("scratch_join", "joins the provided strings", &ScratchJoin);
+        module.add_function("is_scratch_allocated", "checks whether the arguments were allocated from the scratch arena", &IsScratchAllocated);
         
         module.add_function("check_int_conversion", "check integral int type conversions", static_cast<int(*)(int)>(&CheckIntegralIntType));
         module.add_function("check_const_ref_int_conversion", "check integral const ref int type conversions", static_cast<const int&(*)(const int&)>(&CheckIntegralIntType));
@@ -1,9 +1,11 @@
 #pragma once
 
 #include <Python.h>
+#include <cstdint>
 #include <cstring>
 #include <string>
 #include <memory>
+#include <memory_resource>
 #include <vector>
 #include "core/Assert.h"
 #include "Core/Deleter.h"
@@ -18,6 +20,38 @@ namespace sweetPyTest {
     };
 
     int globalFunction(int i){return i;}
+    bool IsGilHeld(){ return PyGILState_Check() == 1; }
+    std::string Describe(int){ return "int"; }
+    std::string Describe(const std::string&){ return "str"; }
+    std::string Describe(int, int){ return "pair"; }
+    std::string Classify(char*){ return "bytes"; }
+    std::string Classify(long value){ return "long " + std::to_string(value); }
+    std::string Classify(const char* value){ return std::string("str ") + value; }
+    template<typename T>
+    T Narrow(T value){ return value; }
+    std::string ScratchJoin(const std::pmr::vector<std::pmr::string>& values)
+    {
+        std::string joined;
+        for(auto& value : values)
+            joined += value;
+        return joined;
+    }
+    bool IsScratchAllocated(const std::pmr::vector<std::pmr::string>& values)
+    {
+        std::pmr::memory_resource* arena = &sweetPy::ScratchArena::instance();
+        bool allocated = values.get_allocator().resource() == arena;
+        for(auto& value : values)
+            allocated = allocated && value.get_allocator().resource() == arena;
+        return allocated;
+    }
+
+    struct alignas(64) AlignedSubject{
+        AlignedSubject():m_value(0){}
+        bool IsAligned() const { return reinterpret_cast<std::uintptr_t>(this) % alignof(AlignedSubject) == 0; }
+        AlignedSubject Copy() const { return *this; }
+        float m_lanes[16];
+        int m_value;
+    };
 
     class TestSubjectC{
     public:
@@ -43,6 +77,7 @@ namespace sweetPyTest {
         const std::string& GetStr() const { return m_str; }
         int Foo(int i){ return i; }
         int Foo(int i, int y){return i+y;}
+        int Sum(int i, int y) const {return m_value + i + y;}
         bool operator==(const TestSubjectB& rhs) const {return m_value == rhs.m_value && m_str == rhs.m_str;}
 
     public:
@@ -389,3 +424,4 @@ namespace sweetPyTest {
     PyObject* CheckIntegralPyObjectType(PyObject* value){ return value; }
 }
 
+PyMODINIT_FUNC PyInit_CPythonClassTestModule();
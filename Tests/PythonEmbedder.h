@@ -1,14 +1,13 @@
 #pragma once
 
 #include <Python.h>
-#include <vector>
-#include <string>
-#include <functional>
 #include <memory>
+#include "Core/Interpreter.h"
 #include "Core/Lock.h"
 #include "Core/Deleter.h"
 #include "Core/PythonAssist.h"
 #include "Detail/CPythonObject.h"
+#include "CPythonClassTestModule.h"
 
 namespace sweetPyTest{
 
@@ -21,24 +20,16 @@ namespace sweetPyTest{
         }
 
         void initiate_interperter(const char* programName, int argc, char** argv){
-            m_name = std::unique_ptr<wchar_t, std::function<void(wchar_t*)>>(
-                    Py_DecodeLocale("CPythonClassTest", nullptr), [](wchar_t* name){PyMem_RawFree(name);});
-            m_argv = {new wchar_t*[argc], std::vector<wchar_t*>()};
-            for(int index = 0; index < argc; index++)
-            {
-                m_argv.second.emplace_back(Py_DecodeLocale(argv[index], nullptr));
-                m_argv.first[index] = m_argv.second.back();
-            }
-            Py_SetProgramName(m_name.get());
-            Py_Initialize();
-            PySys_SetArgv(argc, m_argv.first);
+            m_interpreter.reset(new sweetPy::Interpreter());
+            m_interpreter->set_program_name(programName);
+            m_interpreter->set_arguments(argc, argv);
+            m_interpreter->add_module("CPythonClassTestModule", &PyInit_CPythonClassTestModule);
+            m_interpreter->initialize();
         }
         void terminate_interperter(){
-            Py_Finalize();
-            for(auto& var : m_argv.second)
-                PyMem_RawFree(var);
-            delete[] m_argv.first;
+            m_interpreter.reset();
         }
+        const sweetPy::Interpreter& get_interpreter() const { return *m_interpreter; }
 
         template<typename T>
         static T get_attribute(const char* name){
@@ -47,7 +38,6 @@ namespace sweetPyTest{
             }
         }
     private:
-        std::unique_ptr<wchar_t, std::function<void(wchar_t*)>> m_name;
-        std::pair<wchar_t**, std::vector<wchar_t*>> m_argv;
+        std::unique_ptr<sweetPy::Interpreter> m_interpreter;
     };
 }
\ No newline at end of file
@@ -2,11 +2,19 @@
 #include <type_traits>
 #include <iostream>
 #include <string>
+#include <thread>
+#include <future>
+#include <filesystem>
+#include <unistd.h>
 #include "gtest/gtest.h"
 #include "core/Logger.h"
 #include "PythonEmbedder.h"
 #include "CPythonClassTestModule.h"
 #include "Core/PythonAssist.h"
+#include "Core/Interpreter.h"
+#include "Core/InterpreterPool.h"
+#include "Types/Function.h"
+#include "Utility/CodeCache.h"
 #include "Utility/Types_generated.h"
 #include "Utility/Serialize.h"
 
@@ -884,6 +892,57 @@ namespace sweetPyTest {
          ASSERT_EQ(5, sweetPy::Object<int>::from_python(result.get()));
      }
  
+     TEST(CPythonClassTest, PreparedCall) {
+         const char *testingScript = "def preparedAdd(a, b):\n"
+                                     "   return a + b\n"
+                                     "def preparedGreet(name):\n"
+                                     "   return 'hello ' + name\n"
+                                     "preparedEvents = []\n"
+                                     "def preparedRecord():\n"
+                                     "   preparedEvents.append(1)\n"
+                                     "class PreparedCounter:\n"
+                                     "   def __init__(self):\n"
+                                     "       self.count = 0\n"
+                                     "   def increment(self, step):\n"
+                                     "       self.count += step\n"
+                                     "       return self.count\n"
+                                     "preparedCounter = PreparedCounter()";
+         PyRun_SimpleString(testingScript);
+
+         sweetPy::PreparedCall<int(int, int)> add("__main__", "", "preparedAdd");
+         for(int index = 0; index < 10; index++)
+             ASSERT_EQ(add(index, 2), index + 2);
+         sweetPy::PreparedCall<std::string(const char*)> greet("__main__", "", "preparedGreet");
+         ASSERT_EQ(greet("world"), "hello world");
+         sweetPy::PreparedCall<void()> record("__main__", "", "preparedRecord");
+         record();
+         record();
+         PyRun_SimpleString("preparedEventsCount = len(preparedEvents)");
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("preparedEventsCount"), 2);
+
+         sweetPy::PreparedCall<int(int)> increment("__main__", "preparedCounter", "PreparedCounter.increment");
+         ASSERT_EQ(increment(3), 3);
+         ASSERT_EQ(increment(4), 7);
+         sweetPy::PreparedCall<sweetPy::ObjectPtr(int, int)> addObject(sweetPy::Python::get_attribute("preparedAdd").get());
+         sweetPy::ObjectPtr result = addObject(5, 6);
+         ASSERT_EQ(sweetPy::Object<int>::from_python(result.get()), 11);
+
+         PyRun_SimpleString("def preparedRaise(value):\n"
+                            "   raise ValueError('rejected %d' % value)\n");
+         sweetPy::PreparedCall<int(int)> raising("__main__", "", "preparedRaise");
+         try
+         {
+             raising(3);
+             FAIL() << "A raising hook is expected to throw";
+         }
+         catch(sweetPy::CPythonException& exception)
+         {
+             ASSERT_NE(std::string(exception.what()).find("ValueError: rejected 3"), std::string::npos);
+         }
+         ASSERT_EQ(PyErr_Occurred(), nullptr);
+         ASSERT_EQ(add(1, 1), 2);
+     }
+
      TEST(CPythonClassTest, StaticMethod) {
          const char *testingScript = "TestClass.Setter()\n"
                                      "value = TestClass.Getter()";
@@ -910,7 +969,16 @@ namespace sweetPyTest {
          PyRun_SimpleString(testingScript);
          ASSERT_EQ(PythonEmbedder::get_attribute<int>("a.byValueInt"), 5);
      }
- 
+
+     TEST(CPythonClassTest, NonInternedMemberName) {
+         const char *testingScript = "a = TestClass(7)\n"
+                                     "name = ''.join(['byValue', 'Int'])\n"
+                                     "setattr(a, name, 9)\n"
+                                     "value = getattr(a, name)";
+         PyRun_SimpleString(testingScript);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("value"), 9);
+     }
+
      TEST(CPythonClassTest, DestructorCall) {
          const char *testingScript = "a = TestClass(7)\n"
                                      "del a";
@@ -1024,13 +1092,319 @@ namespace sweetPyTest {
          PyRun_SimpleString(testingScript);
          ASSERT_EQ(PythonEmbedder::get_attribute<int>("result"), 9);
      }
- 
+
+     TEST(CPythonClassTest, ArgumentsCountMismatch) {
+         const char *testingScript = "a = TestClassB()\n"
+                                     "mismatches = 0\n"
+                                     "try:\n"
+                                     "    a.Foo_2(1)\n"
+                                     "except TypeError:\n"
+                                     "    mismatches += 1\n"
+                                     "try:\n"
+                                     "    a.IncValue(1)\n"
+                                     "except TypeError:\n"
+                                     "    mismatches += 1\n"
+                                     "try:\n"
+                                     "    TestClassB(1)\n"
+                                     "except TypeError:\n"
+                                     "    mismatches += 1\n";
+         PyRun_SimpleString(testingScript);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("mismatches"), 3);
+     }
+
+     TEST(CPythonClassTest, MethodDescriptorInvocation) {
+         const char *testingScript = "a = TestClassB()\n"
+                                     "TestClassB.IncValue(a)\n"
+                                     "incValue = a.IncValue\n"
+                                     "incValue()\n"
+                                     "value = a.value\n"
+                                     "mismatches = 0\n"
+                                     "try:\n"
+                                     "    TestClassB.IncValue(TestClass(5))\n"
+                                     "except TypeError:\n"
+                                     "    mismatches += 1\n"
+                                     "try:\n"
+                                     "    TestClassB.IncValue()\n"
+                                     "except TypeError:\n"
+                                     "    mismatches += 1\n"
+                                     "try:\n"
+                                     "    a.missing\n"
+                                     "except AttributeError:\n"
+                                     "    mismatches += 1\n";
+         PyRun_SimpleString(testingScript);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("value"), 2);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("mismatches"), 3);
+     }
+
+     TEST(CPythonClassTest, MethodDescriptorOwnsType) {
+         const char *testingScript = "import gc\n"
+                                     "descriptor = TestClassB.__dict__['IncValue']\n"
+                                     "tracked = gc.is_tracked(descriptor)\n"
+                                     "visited = any(referent is TestClassB for referent in gc.get_referents(descriptor))\n"
+                                     "gc.collect()\n"
+                                     "a = TestClassB()\n"
+                                     "descriptor(a)\n"
+                                     "value = a.value\n";
+         ASSERT_EQ(PyRun_SimpleString(testingScript), 0);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("tracked"), true);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("visited"), true);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("value"), 1);
+     }
+
      TEST(CPythonClassTest, GlobalFunctionInvocation) {
          const char *testingScript = "result = globalFunction(5)";
          PyRun_SimpleString(testingScript);
          ASSERT_EQ(PythonEmbedder::get_attribute<int>("result"), 5);
      }
  
+     TEST(CPythonClassTest, BoundMethodTracked) {
+         const char *testingScript = "import gc\n"
+                                     "a = TestClassB()\n"
+                                     "incValue = a.IncValue\n"
+                                     "tracked = gc.is_tracked(incValue) and gc.is_tracked(globalFunction)\n"
+                                     "visited = any(referent is a for referent in gc.get_referents(incValue))\n"
+                                     "gc.collect()\n"
+                                     "incValue()\n"
+                                     "value = a.value\n";
+         ASSERT_EQ(PyRun_SimpleString(testingScript), 0);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("tracked"), true);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("visited"), true);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("value"), 1);
+     }
+
+     TEST(CPythonClassTest, BatchedInvocation) {
+         const char *testingScript = "values = globalFunction.map(range(100))\n"
+                                     "b = TestClassB()\n"
+                                     "sums = b.Foo_2.map([(1, 2), (3, 4)])\n"
+                                     "b.IncValue.map([(), (), ()])\n"
+                                     "value = b.value\n"
+                                     "mismatch = False\n"
+                                     "try:\n"
+                                     "    b.Foo_2.map([1, 2])\n"
+                                     "except TypeError:\n"
+                                     "    mismatch = True\n"
+                                     "valid = values == list(range(100)) and sums == [3, 7]\n";
+         PyRun_SimpleString(testingScript);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("valid"), true);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("value"), 3);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("mismatch"), true);
+     }
+
+     TEST(CPythonClassTest, ParallelBatchedInvocation) {
+         const char *testingScript = "values = TestModule.parallel_map(globalFunction, range(1000), threads=4)\n"
+                                     "b = TestClassB()\n"
+                                     "sums = TestModule.parallel_map(b.Sum, [(i, 1) for i in range(100)])\n"
+                                     "held = TestModule.parallel_map(TestModule.is_gil_held, [()] * 8, threads=2)\n"
+                                     "mismatch = False\n"
+                                     "try:\n"
+                                     "    TestModule.parallel_map(globalFunction, [1, 'a'])\n"
+                                     "except TypeError:\n"
+                                     "    mismatch = True\n"
+                                     "rejected = 0\n"
+                                     "for function in (TestModule.check_pyobject_conversion, TestModule.check_objectptr_conversion, b.Foo_2):\n"
+                                     "    try:\n"
+                                     "        TestModule.parallel_map(function, [object()] * 8)\n"
+                                     "    except TypeError:\n"
+                                     "        rejected += 1\n"
+                                     "valid = values == list(range(1000)) and sums == [i + 1 for i in range(100)] and not any(held)\n";
+         PyRun_SimpleString(testingScript);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("valid"), true);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("mismatch"), true);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("rejected"), 3);
+     }
+
+     TEST(CPythonClassTest, ReleaseGilPolicy) {
+         const char *testingScript = "held = TestModule.is_gil_held()\n"
+                                     "released = TestModule.is_gil_held_released()\n"
+                                     "foo = TestClassB().Foo_released(7)\n"
+                                     "TestClass.Setter()\n"
+                                     "valid = TestClass.GetterReleased()\n";
+         PyRun_SimpleString(testingScript);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("foo"), 7);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("valid"), true);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("held"), true);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("released"), false);
+     }
+
+     TEST(CPythonClassTest, OverloadedFunctions) {
+         const char *testingScript = "b = TestClassB()\n"
+                                     "single = b.Foo(5)\n"
+                                     "pair = b.Foo(5, 6)\n"
+                                     "described = [TestModule.describe(1), TestModule.describe('a'), TestModule.describe(1, 2)]\n"
+                                     "mapped = TestModule.describe.map([1, 'a', (1, 2)])\n"
+                                     "parallelMapped = TestModule.parallel_map(TestModule.describe, [1, 'a', (1, 2), 2], threads=2)\n"
+                                     "try:\n"
+                                     "    TestModule.describe(1.5)\n"
+                                     "    noMatch = False\n"
+                                     "except TypeError:\n"
+                                     "    noMatch = True\n"
+                                     "describedBytes = [TestModule.describe(b'a'), TestModule.describe(True)]\n"
+                                     "classified = [TestModule.classify(b'a'), TestModule.classify('a'), TestModule.classify(True), TestModule.classify(7)]\n";
+         PyRun_SimpleString(testingScript);
+         std::vector<std::string> expectedBytes = {"str", "int"};
+         ASSERT_EQ(PythonEmbedder::get_attribute<std::vector<std::string>>("describedBytes"), expectedBytes);
+         std::vector<std::string> classified = {"bytes", "str a", "long 1", "long 7"};
+         ASSERT_EQ(PythonEmbedder::get_attribute<std::vector<std::string>>("classified"), classified);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("single"), 5);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("pair"), 11);
+         std::vector<std::string> expected = {"int", "str", "pair"};
+         ASSERT_EQ(PythonEmbedder::get_attribute<std::vector<std::string>>("described"), expected);
+         ASSERT_EQ(PythonEmbedder::get_attribute<std::vector<std::string>>("mapped"), expected);
+         std::vector<std::string> parallelExpected = {"int", "str", "pair", "int"};
+         ASSERT_EQ(PythonEmbedder::get_attribute<std::vector<std::string>>("parallelMapped"), parallelExpected);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("noMatch"), true);
+     }
+
+     TEST(CPythonClassTest, IntegralRange) {
+         const char *testingScript = "def overflows(function, value):\n"
+                                     "    try:\n"
+                                     "        function(value)\n"
+                                     "        return False\n"
+                                     "    except OverflowError:\n"
+                                     "        return True\n"
+                                     "inRange = [TestModule.narrow_short(32767), TestModule.narrow_short(-32768), TestModule.narrow_char(127),\n"
+                                     "           TestModule.narrow_uint8(255), TestModule.narrow_unsigned(4294967295)]\n"
+                                     "uint64Max = TestModule.narrow_uint64(2**64 - 1)\n"
+                                     "uint64AboveLong = TestModule.narrow_uint64(2**63) == 2**63\n"
+                                     "overflown = [overflows(TestModule.narrow_short, 32768), overflows(TestModule.narrow_short, -32769),\n"
+                                     "             overflows(TestModule.narrow_short, 70000), overflows(TestModule.narrow_char, 70000),\n"
+                                     "             overflows(TestModule.narrow_uint8, 256), overflows(TestModule.narrow_uint8, -1),\n"
+                                     "             overflows(TestModule.narrow_unsigned, -1), overflows(TestModule.narrow_unsigned, 4294967296),\n"
+                                     "             overflows(TestModule.narrow_uint64, -1), overflows(TestModule.narrow_uint64, 2**64)]\n";
+         PyRun_SimpleString(testingScript);
+         std::vector<long> inRange = {32767, -32768, 127, 255, 4294967295};
+         ASSERT_EQ(PythonEmbedder::get_attribute<std::vector<long>>("inRange"), inRange);
+         ASSERT_EQ(PythonEmbedder::get_attribute<std::uint64_t>("uint64Max"), std::numeric_limits<std::uint64_t>::max());
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("uint64AboveLong"), true);
+         ASSERT_EQ(PythonEmbedder::get_attribute<std::vector<bool>>("overflown"), std::vector<bool>(10, true));
+     }
+
+     TEST(CPythonClassTest, FreeListAllocation) {
+         const sweetPy::FreeList& values = sweetPy::TypesContainer::instance().get_type(sweetPy::Hash::generate_hash_code<TestSubjectB>()).get_free_list();
+         const sweetPy::FreeList& references = sweetPy::TypesContainer::instance().get_type(sweetPy::Hash::generate_hash_code<sweetPy::ReferenceObject<TestSubjectB>>()).get_free_list();
+         std::size_t valueHits = values.get_hits();
+         std::size_t referenceHits = references.get_hits();
+         const char *testingScript = "a = TestClass(5)\n"
+                                     "for i in range(100):\n"
+                                     "    b = TestClassB()\n"
+                                     "    ref = a.GetB()\n"
+                                     "del b, ref\n";
+         PyRun_SimpleString(testingScript);
+         ASSERT_GE(values.get_hits() - valueHits, 99);
+         ASSERT_GE(references.get_hits() - referenceHits, 99);
+         ASSERT_LE(values.get_size(), values.get_capacity());
+         ASSERT_EQ(values.get_capacity(), 16);
+     }
+
+     TEST(CPythonClassTest, InstanceLayout) {
+         ASSERT_EQ(sweetPy::ClazzObject<TestSubjectB>::get_size(), sizeof(PyObject) + sizeof(TestSubjectB));
+         const char *testingScript = "a = TestClass(5)\n"
+                                     "ref = a.GetB()\n"
+                                     "ref.IncValue()\n"
+                                     "value = TestClassB()\n"
+                                     "isValue = type(value) is TestClassB\n"
+                                     "isRef = type(ref) is not TestClassB\n";
+         PyRun_SimpleString(testingScript);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("isValue"), true);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("isRef"), true);
+     }
+
+     TEST(CPythonClassTest, OverAlignedInstances) {
+         const char *testingScript = "instances = [TestModule.AlignedClass() for i in range(16)]\n"
+                                     "instances += [instance.copy() for instance in instances]\n"
+                                     "instances[0].value = 5\n"
+                                     "aligned = all(instance.is_aligned() for instance in instances)\n"
+                                     "value = instances[0].value\n";
+         PyRun_SimpleString(testingScript);
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("aligned"), true);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("value"), 5);
+     }
+
+     TEST(CPythonClassTest, ObjectHandle) {
+         ASSERT_EQ(sizeof(sweetPy::ObjectPtr), 2 * sizeof(void*));
+         PyObject* object = PyUnicode_FromString("handle");
+         Py_ssize_t refCount = Py_REFCNT(object);
+         {
+             sweetPy::ObjectPtr borrowed(object, &sweetPy::Deleter::Borrow);
+             Py_INCREF(object);
+             sweetPy::ObjectPtr owner(object, &sweetPy::Deleter::Owner);
+             sweetPy::ObjectPtr moved = std::move(owner);
+             ASSERT_EQ(owner, nullptr);
+             ASSERT_EQ(moved.get(), object);
+             Py_INCREF(object);
+             sweetPy::ObjectPtr gilOwner(object, &sweetPy::Deleter::GilOwner);
+             ASSERT_EQ(Py_REFCNT(object), refCount + 2);
+         }
+         ASSERT_EQ(Py_REFCNT(object), refCount);
+         Py_DECREF(object);
+     }
+
+     TEST(CPythonClassTest, DeferredDecRef) {
+         sweetPy::DecRefQueue& queue = sweetPy::DecRefQueue::instance();
+         std::size_t drained = queue.get_drained();
+         PyObject* object = PyUnicode_FromString("deferred");
+         Py_ssize_t refCount = Py_REFCNT(object);
+         std::vector<sweetPy::ObjectPtr> handles;
+         for(int index = 0; index < 10; index++)
+         {
+             Py_INCREF(object);
+             handles.emplace_back(object, &sweetPy::Deleter::GilOwner);
+         }
+         std::thread worker([&handles]{ handles.clear(); }); //The worker doesn't hold the GIL.
+         worker.join();
+         ASSERT_EQ(Py_REFCNT(object), refCount + 10);
+         ASSERT_GE(queue.get_depth(), 10);
+         {
+             sweetPy::GilLock lock;
+         }
+         ASSERT_EQ(Py_REFCNT(object), refCount);
+         ASSERT_EQ(queue.get_depth(), 0);
+         ASSERT_EQ(queue.get_drained() - drained, 10);
+         ASSERT_GE(queue.get_max_depth(), 10);
+         Py_DECREF(object);
+     }
+
+     TEST(CPythonClassTest, ScratchArenaArguments) {
+         const char *testingScript = "words = ['a' * 64, 'b' * 64, 'c']\n"
+                                     "joined = TestModule.scratch_join(words)\n"
+                                     "allocated = TestModule.is_scratch_allocated(words)\n"
+                                     "for i in range(100):\n"
+                                     "    TestModule.scratch_join(words)\n";
+         PyRun_SimpleString(testingScript);
+         ASSERT_EQ(PythonEmbedder::get_attribute<std::string>("joined"), std::string(64, 'a') + std::string(64, 'b') + "c");
+         ASSERT_EQ(PythonEmbedder::get_attribute<bool>("allocated"), true);
+         const sweetPy::ScratchArena& arena = sweetPy::ScratchArena::instance();
+         std::size_t capacity = arena.get_capacity();
+         PyRun_SimpleString("for i in range(100):\n"
+                            "    TestModule.scratch_join(words)\n");
+         ASSERT_GT(capacity, 0);
+         ASSERT_EQ(arena.get_capacity(), capacity);
+     }
+
+     TEST(CPythonClassTest, NestedGilLock) {
+         ASSERT_EQ(sweetPy::GilState::m_depth, 0);
+         {
+             sweetPy::GilLock outer;
+             sweetPy::GilLock inner;
+             ASSERT_EQ(sweetPy::GilState::m_depth, 2);
+             {
+                 sweetPy::GilRelease release;
+                 ASSERT_EQ(sweetPy::GilState::m_depth, 0);
+                 ASSERT_FALSE(PyGILState_Check());
+                 {
+                     sweetPy::GilLock reacquired;
+                     ASSERT_TRUE(PyGILState_Check());
+                     ASSERT_EQ(sweetPy::GilState::m_depth, 1);
+                 }
+                 ASSERT_FALSE(PyGILState_Check());
+             }
+             ASSERT_TRUE(PyGILState_Check());
+             ASSERT_EQ(sweetPy::GilState::m_depth, 2);
+         }
+         ASSERT_EQ(sweetPy::GilState::m_depth, 0);
+         ASSERT_TRUE(PyGILState_Check());
+     }
+
      TEST(CPythonClassTest, from_pythonStrToNativeXpireStrArgument) {
          const char *testingScript = "a = TestClass(5)\n"
                                      "a.SetXpireValue('Xpire Value')\n"
@@ -1063,7 +1437,155 @@ namespace sweetPyTest {
          ASSERT_EQ(b_lvalue.m_str, "Hello World");
          ASSERT_EQ(b_lvalue.m_value, 0);
      }
-     
+
+     TEST(CPythonClassTest, CodeCache)
+     {
+         std::string directory = (std::filesystem::temp_directory_path() / ("sweetPyCodeCache" + std::to_string(::getpid()))).string();
+         std::string source = "def scale(value, factor=2):\n"
+                              "    return value * factor\n"
+                              "cachedResult = scale(21)";
+         {
+             sweetPy::CodeCache cache(directory);
+             sweetPy::ObjectPtr code = cache.compile(source, "cached.py");
+             ASSERT_EQ(cache.get_misses(), 1);
+             ASSERT_EQ(cache.get_hits(), 0);
+             sweetPy::CodeObject description(code.get());
+             ASSERT_EQ(description.get_file_name(), "cached.py");
+         }
+         {
+             sweetPy::CodeCache cache(directory);
+             sweetPy::ObjectPtr code = cache.compile(source, "cached.py");
+             ASSERT_EQ(cache.get_hits(), 1);
+             ASSERT_EQ(cache.get_misses(), 0);
+             PyObject* globals = PyModule_GetDict(PyImport_AddModule("__main__"));
+             sweetPy::ObjectPtr result(PyEval_EvalCode(code.get(), globals, globals), &sweetPy::Deleter::Owner);
+             ASSERT_NE(result.get(), nullptr);
+             ASSERT_EQ(PythonEmbedder::get_attribute<int>("cachedResult"), 42);
+             sweetPy::PythonFunction scale(sweetPy::Python::get_attribute("scale").get());
+             ASSERT_EQ(scale.get_name(), "scale");
+             ASSERT_EQ(scale.get_code_object().get_arg_count(), 2);
+
+             cache.compile(source, "other.py");
+             ASSERT_EQ(cache.get_misses(), 1);
+             ASSERT_THROW(cache.compile("def broken(:", "broken.py"), sweetPy::CPythonException);
+             PyErr_Clear();
+         }
+         {
+             //Optimization levels are cached apart, neither overwrites the other's entry.
+             sweetPy::CodeCache optimized(directory, 2);
+             optimized.compile(source, "cached.py");
+             ASSERT_EQ(optimized.get_misses(), 1);
+             sweetPy::CodeCache cache(directory);
+             cache.compile(source, "cached.py");
+             ASSERT_EQ(cache.get_hits(), 1);
+             optimized.compile(source, "cached.py");
+             ASSERT_EQ(optimized.get_hits(), 1);
+         }
+         std::filesystem::remove_all(directory);
+     }
+
+     TEST(CPythonClassTest, Interpreter)
+     {
+         const sweetPy::Interpreter& interpreter = PythonEmbedder::instance().get_interpreter();
+         ASSERT_TRUE(interpreter.is_initialized());
+         ASSERT_GT(interpreter.get_timings().m_initialization.count(), 0);
+         ASSERT_EQ(interpreter.get_timings().get_total(), interpreter.get_timings().m_preInitialization + interpreter.get_timings().m_configuration +
+                   interpreter.get_timings().m_initialization + interpreter.get_timings().m_imports);
+         PyRun_SimpleString("import sys\n"
+                            "builtin = 'CPythonClassTestModule' in sys.builtin_module_names\n"
+                            "argumentsCount = len(sys.argv)");
+         ASSERT_TRUE(PythonEmbedder::get_attribute<bool>("builtin"));
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("argumentsCount"), _argc);
+
+         sweetPy::Interpreter second;
+         ASSERT_THROW(second.initialize(), sweetPy::CPythonException);
+         ASSERT_FALSE(second.is_initialized());
+     }
+
+     //Runs last among the interpreter tests, python 3.8 disables PyGILState_Check once a sub interpreter is created.
+     TEST(CPythonClassTest, SubInterpreter)
+     {
+         sweetPy::TypesContainer& mainTypes = sweetPy::TypesContainer::instance();
+         std::size_t statesCount = sweetPy::InterpreterState::get_count();
+         PyThreadState* mainState = PyThreadState_Get();
+         PyThreadState* subState = Py_NewInterpreter();
+         ASSERT_NE(subState, nullptr);
+         std::string subScript = "import CPythonClassTestModule as TestModule\n"
+                                 "a = TestModule.TestClass(7)\n"
+                                 "a.IncBaseValue()\n"
+                                 "result = a.GetBaseValue()\n"
+                                 "num = TestModule.globalFunction(77)";
+         ASSERT_EQ(PyRun_SimpleString(subScript.c_str()), 0);
+         //The thread initializing the sub interpreter's module runs its state.
+         ASSERT_EQ(sweetPy::GilState::get_attached(), subState);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("result"), 1);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("num"), 77);
+         ASSERT_EQ(sweetPy::InterpreterState::get_count(), statesCount + 1);
+         ASSERT_NE(&sweetPy::TypesContainer::instance(), &mainTypes);
+         Py_EndInterpreter(subState);
+         PyThreadState_Swap(mainState);
+         ASSERT_EQ(sweetPy::InterpreterState::get_count(), statesCount);
+         ASSERT_EQ(sweetPy::GilState::get_attached(), mainState);
+         PyThreadState* foreign = mainState;
+         std::thread([&foreign]{ foreign = sweetPy::GilState::get_attached(); }).join();
+         ASSERT_EQ(foreign, nullptr);
+
+         ASSERT_EQ(&sweetPy::TypesContainer::instance(), &mainTypes);
+         const char *testingScript = "b = TestClass(7)\n"
+                                     "b.IncBaseValue()\n"
+                                     "result = b.GetBaseValue()";
+         ASSERT_EQ(PyRun_SimpleString(testingScript), 0);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("result"), 1);
+     }
+
+     TEST(CPythonClassTest, InterpreterPool)
+     {
+         std::size_t statesCount = sweetPy::InterpreterState::get_count();
+         std::int64_t mainId = sweetPy::InterpreterState::get().get_id();
+         {
+             sweetPy::InterpreterPool pool(2, "import CPythonClassTestModule as TestModule");
+             ASSERT_EQ(pool.get_interpreters_count(), 2);
+             ASSERT_EQ(sweetPy::InterpreterState::get_count(), statesCount + 2);
+             std::vector<std::future<int>> results;
+             for(int index = 0; index < 8; index++)
+                 results.emplace_back(pool.evaluate<int>("TestModule.globalFunction(" + std::to_string(index) + ")"));
+             for(int index = 0; index < 8; index++)
+                 ASSERT_EQ(sweetPy::InterpreterPool::get(results[index]), index);
+             
+             auto id = pool.submit([]{ return sweetPy::InterpreterState::get().get_id(); });
+             ASSERT_NE(sweetPy::InterpreterPool::get(id), mainId);
+             auto failure = pool.run("raise ValueError('expected failure')");
+             ASSERT_THROW(sweetPy::InterpreterPool::get(failure), sweetPy::CPythonException);
+             auto prepared = pool.submit([]{ sweetPy::PreparedCall<int(int)> call("builtins", "", "abs"); return call(-1); });
+             ASSERT_THROW(sweetPy::InterpreterPool::get(prepared), sweetPy::CPythonException);
+         }
+         const char *testingScript = "b = TestClass(7)\n"
+                                     "b.IncBaseValue()\n"
+                                     "result = b.GetBaseValue()";
+         ASSERT_EQ(PyRun_SimpleString(testingScript), 0);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("result"), 1);
+     }
+
+     TEST(CPythonClassTest, InterpreterPoolReleasesStates)
+     {
+         std::size_t statesCount = sweetPy::InterpreterState::get_count();
+         for(int round = 0; round < 2; round++)
+         {
+             {
+                 sweetPy::InterpreterPool pool(2, "import CPythonClassTestModule as TestModule");
+                 ASSERT_EQ(sweetPy::InterpreterState::get_count(), statesCount + 2);
+                 auto result = pool.evaluate<int>("TestModule.globalFunction(5)");
+                 ASSERT_EQ(sweetPy::InterpreterPool::get(result), 5);
+             }
+             ASSERT_EQ(sweetPy::InterpreterState::get_count(), statesCount);
+         }
+         const char *testingScript = "b = TestClass(7)\n"
+                                     "b.IncBaseValue()\n"
+                                     "result = b.GetBaseValue()";
+         ASSERT_EQ(PyRun_SimpleString(testingScript), 0);
+         ASSERT_EQ(PythonEmbedder::get_attribute<int>("result"), 1);
+     }
+
      TEST(CPythonClassTest, Serialize)
      {
          const char *testingScript = "int_val = 6\n"
@@ -1201,10 +1723,10 @@ namespace sweetPyTest {
 }
 
 int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
     _argc = argc;
     _argv = argv;
     ::testing::AddGlobalTestEnvironment(new sweetPyTest::CPythonClassTest);
-    ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
 }
 
@@ -0,0 +1,254 @@
+#include <Python.h>
+#include <atomic>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/Logger.h"
+#include "sweetPy.h"
+#include "Core/PythonAssist.h"
+#include "Utility/CodeCache.h"
+
+using namespace sweetPy;
+
+//Every C++ heap allocation performed by the process, sweetPy's conversions included.
+static std::atomic<std::size_t> allocations{0};
+
+void* operator new(std::size_t size)
+{
+    allocations++;
+    if(void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+namespace benchmark {
+
+    int add(int lhs, int rhs){ return lhs + rhs; }
+    double scale(double value){ return value * 2; }
+    void noop(){}
+    int total(std::vector<int> values)
+    {
+        int sum = 0;
+        for(int value : values)
+            sum += value;
+        return sum;
+    }
+    int total_scratch(const std::pmr::vector<int>& values)
+    {
+        int sum = 0;
+        for(int value : values)
+            sum += value;
+        return sum;
+    }
+    double work(int iterations)
+    {
+        double value = 0;
+        for(int index = 1; index <= iterations; index++)
+            value += 1.0 / index;
+        return value;
+    }
+
+    class Point{
+    public:
+        Point():m_x(0), m_y(0){}
+        Point(int x, int y):m_x(x), m_y(y){}
+        int sum() const { return m_x + m_y; }
+        void move(int x, int y){ m_x += x; m_y += y; }
+        Point mirror() const { return Point(m_y, m_x); }
+        int dot(const Point& other) const { return m_x * other.m_x + m_y * other.m_y; }
+
+    public:
+        int m_x;
+        int m_y;
+    };
+}
+
+INIT_MODULE(sweetPyBenchmark, "sweetPy micro benchmarks")
+{
+    module.add_function("add", "add two integers", &benchmark::add);
+    module.add_function("scale", "double a value", &benchmark::scale);
+    module.add_function("noop", "does nothing", &benchmark::noop);
+    module.add_function("total", "sum of a list of integers", &benchmark::total);
+    module.add_function("total_scratch", "sum of a list of integers, converted into the scratch arena", &benchmark::total_scratch);
+    module.add_function("work", "compute bound function", &benchmark::work);
+
+    Clazz<benchmark::Point> point(module, "Point", "two dimensional point");
+    point.add_constructor<int, int>();
+    point.enable_free_list(64);
+    point.add_method("sum", "sum of both coordinates", &benchmark::Point::sum);
+    point.add_method("move", "move the point", &benchmark::Point::move);
+    point.add_method("mirror", "returns the mirrored point by value", &benchmark::Point::mirror);
+    point.add_method("dot", "dot product with another point", &benchmark::Point::dot);
+    point.add_member("x", &benchmark::Point::m_x, "x coordinate");
+    point.add_member("y", &benchmark::Point::m_y, "y coordinate");
+}
+
+struct Scenario
+{
+    const char* name;
+    const char* statement;
+};
+
+static void run(const Scenario& scenario, int iterations)
+{
+    std::string script = std::string("for _ in range(") + std::to_string(iterations) + "):\n    " + scenario.statement + "\n";
+    std::size_t allocationsBefore = allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    PyRun_SimpleString(script.c_str());
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    std::size_t allocationsAfter = allocations.load();
+
+    std::cout << std::left << std::setw(32) << scenario.name
+              << std::right << std::setw(12) << std::fixed << std::setprecision(1)
+              << (double)elapsed.count() / iterations << " ns/call"
+              << std::setw(12) << std::setprecision(2)
+              << (double)(allocationsAfter - allocationsBefore) / iterations << " allocs/call"
+              << std::endl;
+}
+
+//Python bound tasks spread over a pool of interpreters, scaling with the pool's size given each interpreter owns a GIL.
+static void run_pool(std::size_t interpretersCount, std::size_t tasksCount)
+{
+    InterpreterPool pool(interpretersCount, "from sweetPyBenchmark import *");
+    std::vector<std::future<int>> results;
+    auto start = std::chrono::steady_clock::now();
+    for(std::size_t task = 0; task < tasksCount; task++)
+        results.emplace_back(pool.evaluate<int>("sum(add(value, 1) for value in range(2000))"));
+    for(auto& result : results)
+        InterpreterPool::get(result);
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << std::left << std::setw(32) << ("interpreter pool(" + std::to_string(interpretersCount) + ")")
+              << std::right << std::setw(12) << std::fixed << std::setprecision(1)
+              << tasksCount * 1e9 / elapsed.count() << " tasks/s" << std::endl;
+}
+
+//C++ code calling a python hook per event, resolved upon every call versus prepared once.
+static void run_hook(int iterations)
+{
+    PyRun_SimpleString("def hook(a, b):\n"
+                       "    return a + b\n");
+    auto report = [iterations](const char* name, std::chrono::nanoseconds elapsed){
+        std::cout << std::left << std::setw(32) << name
+                  << std::right << std::setw(12) << std::fixed << std::setprecision(1)
+                  << (double)elapsed.count() / iterations << " ns/call" << std::endl;
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    for(int index = 0; index < iterations; index++)
+        ObjectPtr result = Python::invoke_function("__main__", "", "hook", index + 0, 1);
+    report("hook via invoke_function", std::chrono::steady_clock::now() - start);
+
+    PreparedCall<int(int, int)> hook("__main__", "", "hook");
+    start = std::chrono::steady_clock::now();
+    for(int index = 0; index < iterations; index++)
+        hook(index, 1);
+    report("hook via PreparedCall", std::chrono::steady_clock::now() - start);
+}
+
+//An embedded host's startup script, compiled with no cache, into an empty cache (cold) and loaded from it (warm).
+static void run_code_cache(int functionsCount, int rounds)
+{
+    std::string source;
+    for(int index = 0; index < functionsCount; index++)
+        source += "def handler_" + std::to_string(index) + "(request, retries=3):\n"
+                  "    for attempt in range(retries):\n"
+                  "        if request.get('id') == " + std::to_string(index) + " and attempt % 2 == 0:\n"
+                  "            return {'status': 'ok', 'attempt': attempt, 'payload': [value * 2 for value in request['values']]}\n"
+                  "    raise RuntimeError('handler " + std::to_string(index) + " failed')\n";
+    std::string directory = (std::filesystem::temp_directory_path() / "sweetPyBenchmarkCodeCache").string();
+    std::chrono::nanoseconds compiled(0), cold(0), warm(0);
+    for(int round = 0; round < rounds; round++)
+    {
+        std::filesystem::remove_all(directory);
+        auto start = std::chrono::steady_clock::now();
+        ObjectPtr code(Py_CompileString(source.c_str(), "startup.py", Py_file_input), &Deleter::Owner);
+        auto compiledEnd = std::chrono::steady_clock::now();
+        {
+            CodeCache cache(directory);
+            ObjectPtr coldCode = cache.compile(source, "startup.py");
+        }
+        auto coldEnd = std::chrono::steady_clock::now();
+        {
+            CodeCache cache(directory);
+            ObjectPtr warmCode = cache.compile(source, "startup.py");
+        }
+        auto warmEnd = std::chrono::steady_clock::now();
+        compiled += compiledEnd - start;
+        cold += coldEnd - compiledEnd;
+        warm += warmEnd - coldEnd;
+    }
+    std::filesystem::remove_all(directory);
+
+    auto report = [rounds, functionsCount](const char* name, std::chrono::nanoseconds elapsed){
+        std::cout << std::left << std::setw(32) << ("code cache " + std::string(name) + "(" + std::to_string(functionsCount) + " defs)")
+                  << std::right << std::setw(12) << std::fixed << std::setprecision(1)
+                  << (double)elapsed.count() / rounds / 1000 << " us/startup" << std::endl;
+    };
+    report("compile", compiled);
+    report("cold", cold);
+    report("warm", warm);
+}
+
+int main(int argc, const char *argv[])
+{
+    core::Logger::Instance().Start(core::TraceSeverity::Info);
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 1000000;
+
+    wchar_t* decodedName = Py_DecodeLocale(argv[0], nullptr);
+    Py_SetProgramName(decodedName);
+    PyImport_AppendInittab("sweetPyBenchmark", &PyInit_sweetPyBenchmark);
+    Py_Initialize();
+    PyRun_SimpleString("from sweetPyBenchmark import *\n"
+                       "p = Point(1, 2)\n"
+                       "pairs = [(1, 2)] * 100\n"
+                       "values = list(range(100))\n"
+                       "loads = [10000] * 64\n");
+
+    std::vector<Scenario> scenarios = {
+        {"function()", "noop()"},
+        {"function(int, int)", "add(1, 2)"},
+        {"function(double)", "scale(1.5)"},
+        {"function(list of 100 int)", "total(values)"},
+        {"function(pmr list of 100 int)", "total_scratch(values)"},
+        {"constructor(int, int)", "Point(1, 2)"},
+        {"method() const", "p.sum()"},
+        {"method(int, int)", "p.move(1, 1)"},
+        {"method() returning by value", "p.mirror()"},
+        {"method(const Point&)", "p.dot(p)"},
+        {"member get", "p.x"},
+        {"member set", "p.x = 1"},
+        {"100 x function(int, int)", "[add(*pair) for pair in pairs]"},
+        {"function(int, int).map(100)", "add.map(pairs)"},
+        {"work.map(64 x 10000)", "work.map(loads)"},
+        {"parallel_map(work, 64 x 10000)", "parallel_map(work, loads)"},
+    };
+    for(auto& scenario : scenarios)
+        run(scenario, iterations);
+
+    std::vector<std::size_t> poolSizes = {1, 2, 4, std::max<std::size_t>(1, std::thread::hardware_concurrency())};
+    std::sort(poolSizes.begin(), poolSizes.end());
+    poolSizes.erase(std::unique(poolSizes.begin(), poolSizes.end()), poolSizes.end());
+    for(std::size_t poolSize : poolSizes)
+        run_pool(poolSize, 256);
+    run_hook(iterations);
+    run_code_cache(200, 20);
+
+    Py_Finalize();
+    PyMem_RawFree(decodedName);
+    return 0;
+}
@@ -40,13 +40,20 @@ INIT_MODULE(example, "Example doc")
 int main( int argc, const char *argv[] )
 {
     core::Logger::Instance().Start(core::TraceSeverity::Info);
-    char* programName = const_cast<char*>(argv[0]);
-    wchar_t* decodedName = Py_DecodeLocale(programName, nullptr);
-    Py_SetProgramName(decodedName);
-    Py_Initialize();
-    PyInit_example();
-    Py_Finalize();
-    PyMem_RawFree(decodedName);
+    {
+        Interpreter interpreter;
+        interpreter.set_program_name(argv[0]);
+        interpreter.set_arguments(argc, const_cast<char**>(argv));
+        interpreter.set_isolated(true);
+        interpreter.set_site_import(false);
+        interpreter.add_module("example", &PyInit_example);
+        interpreter.add_import("example");
+        interpreter.initialize();
+
+        const Interpreter::Timings& timings = interpreter.get_timings();
+        std::cout<<"pre initialization "<<timings.m_preInitialization.count()<<"ns, configuration "<<timings.m_configuration.count()
+                 <<"ns, initialization "<<timings.m_initialization.count()<<"ns, imports "<<timings.m_imports.count()<<"ns"<<std::endl;
+    }
 
     return 0;
 }
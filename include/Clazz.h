@@ -21,7 +21,6 @@
 #include "Detail/Member.h"
 #include "Detail/Function.h"
 #include "Detail/ConcreteFunction.h"
-#include "Detail/TypedMemberAccessor.h"
 #include "Detail/Object.h"
 #include "Module.h"
 
@@ -51,10 +50,10 @@ namespace sweetPy {
                 };
                 std::size_t hashCode = Hash::generate_hash_code<X>();
             
-                std::unique_ptr<PyObject, std::function<void(PyObject*)>> plainType(
+                ObjectPtr plainType(
                         CPythonType::get_py_object(
                                 new PlainType(namePrefix + std::to_string(hashCode), "", ClazzObject<X>::get_size(),
-                                              hashCode, objectDestroyer)
+                                              hashCode, objectDestroyer, alignof(ClazzObject<X>))
                         ),
                         [](PyObject* ptr){
                             auto plainType = static_cast<PlainType*>(CPythonType::get_type(ptr));
@@ -86,7 +85,8 @@ namespace sweetPy {
                 if(!module.is_type_exists(type.get_hash_code()))
                 {
                     static_cast<PlainType&>(type).finalize();
-                    TypesContainer::instance().add_type(type.get_hash_code(), type, false);
+                    type.enable_free_list(module.get_free_list_capacity());
+                    TypesContainer::instance().add_type<X>(type, false);
                     module.add_type(type.get_hash_code(), std::move(plainType), false);
                 }
                 return nullptr;
@@ -106,7 +106,7 @@ namespace sweetPy {
             static void* initialize_type(Module& module, const std::string& namePrefix)
             {
                 std::size_t hashCode = Hash::generate_hash_code<ReferenceObject<_X>>();
-                std::unique_ptr<PyObject, std::function<void(PyObject*)>> plainType(
+                ObjectPtr plainType(
                         CPythonType::get_py_object(
                                 new PlainType(namePrefix + std::to_string(hashCode), "", ClazzObject<ReferenceObject<_X>>::get_size(),
                                               hashCode, [](PyObject*){})
@@ -140,7 +140,8 @@ namespace sweetPy {
                 if(!module.is_type_exists(type.get_hash_code()))
                 {
                     static_cast<PlainType&>(type).finalize();
-                    TypesContainer::instance().add_type(type.get_hash_code(), type, false);
+                    type.enable_free_list(module.get_free_list_capacity());
+                    TypesContainer::instance().add_type<ReferenceObject<_X>>(type, false);
                     module.add_type(type.get_hash_code(), std::move(plainType), false);
                 }
                 return nullptr;
@@ -204,14 +205,13 @@ namespace sweetPy {
                 : m_module(module),
                   m_type(CPythonType::get_py_object(new PyType(name, doc, &free_type)), &Deleter::Owner),
                   m_context(static_cast<PyType*>(CPythonType::get_type(m_type.get()))->get_context()),
-                  m_forceInsertion(forceInsertion)
+                  m_forceInsertion(forceInsertion), m_freeListCapacity(0)
         {
         }
 
         ~Clazz()
         {
             init_members();
-            init_methods();
             init_static_methods();
     
             CPythonType& type = *CPythonType::get_type(m_type.get());
@@ -220,13 +220,21 @@ namespace sweetPy {
             
             PyType_Ready(&type.ht_type);
             type.clear_trace_ref();
-            ReferenceType<T> refType(m_module, std::string(type.get_name()) + "_ref", "", m_context);
-            ReferenceType<T const> refConstType(m_module, std::string(type.get_name()) + "_const_ref", "", m_context);
+            init_methods();
+            ReferenceType<T> refType(m_module, std::string(type.get_name()) + "_ref", "", m_context, m_freeListCapacity);
+            ReferenceType<T const> refConstType(m_module, std::string(type.get_name()) + "_const_ref", "", m_context, m_freeListCapacity);
             
-            TypesContainer::instance().add_type(type.get_hash_code(), type, m_forceInsertion);
+            TypesContainer::instance().add_type<T>(type, m_forceInsertion);
             m_module.add_type(type.get_hash_code(), std::move(m_type));
         }
 
+        //Instances and reference wrappers of T are allocated through free lists retaining up to capacity instances each.
+        void enable_free_list(std::size_t capacity)
+        {
+            m_freeListCapacity = capacity;
+            CPythonType::get_type(m_type.get())->enable_free_list(capacity);
+        }
+
         template<typename X, typename = enable_if_t<std::is_member_function_pointer<X>::value>>
         void add_method(const std::string &name, const std::string &doc, X &&memberFunction) {
             typedef MemberFunction<T, X> FuncType;
@@ -240,6 +248,20 @@ namespace sweetPy {
             m_memberStaticFunctions.emplace_back(new FuncType(name, doc, memberFunction));
             FunctionTypesInitializer<X>::initialize_types(m_module, "C");
         }
+
+        template<typename X, typename = enable_if_t<std::is_member_function_pointer<X>::value>>
+        void add_method(const std::string &name, const std::string &doc, X &&memberFunction, ReleaseGil) {
+            static_assert(!is_python_signature<std::decay_t<X>>::value, "Methods taking or returning python objects require the GIL");
+            add_method(name, doc, std::forward<X>(memberFunction));
+            m_memberFunctions.back()->set_release_gil(true);
+        }
+    
+        template<typename X, typename = enable_if_t<is_function_pointer<X>::value>>
+        void add_static_method(const std::string &name, const std::string &doc, X &&memberFunction, ReleaseGil) {
+            static_assert(!is_python_signature<std::decay_t<X>>::value, "Methods taking or returning python objects require the GIL");
+            add_static_method(name, doc, std::forward<X>(memberFunction));
+            m_memberStaticFunctions.back()->set_release_gil(true);
+        }
     
         template<typename... Args>
         enable_if_t<!std::is_constructible<T, Args...>::value>
@@ -259,9 +281,6 @@ namespace sweetPy {
         void add_member(const std::string &name, X T::* member, const std::string &doc)
         {
             m_members.emplace_back(new TypedMember<T, X>(name, member, doc));
-            int offset = get_offset(member);
-            ClazzContext::MemberAccessorPtr accessor(new TypedMemberAccessor<Self, X>(offset));
-            m_context.add_member(offset, std::move(accessor));
         }
         
     private:
@@ -269,16 +288,12 @@ namespace sweetPy {
         {
             if(m_memberFunctions.empty() == false)
             {
-                PyMethodDef *methods = new PyMethodDef[m_memberFunctions.size() + 1]; //spare space for sentinal
-                reinterpret_cast<PyTypeObject*>(m_type.get())->tp_methods = methods;
                 for (auto &method : m_memberFunctions)
                 {
-                    *methods = *method->to_python();
                     std::size_t hash_code = method->get_hash_code();
                     m_context.add_member_function(hash_code, ClazzContext::FunctionPtr(method.release()));
-                    methods++;
                 }
-                *methods = {NULL, NULL, 0, NULL};
+                static_cast<PyType*>(CPythonType::get_type(m_type.get()))->init_methods();
             }
         }
         void init_static_methods()
@@ -297,18 +312,19 @@ namespace sweetPy {
                 m_module.add_type(metaClass.get_hash_code(), std::move(type));
             }
         }
+        //Members are exposed as get set descriptors, resolved by name through the type's dictionary.
         void init_members()
         {
             if( m_members.empty() == false)
             {
-                PyMemberDef *members = new PyMemberDef[m_members.size() + 1]; //spare space for sentinal
-                CPythonType::get_type(m_type.get())->ht_type.tp_members = members;
+                PyGetSetDef *getSetDefs = new PyGetSetDef[m_members.size() + 1]; //spare space for sentinal
+                CPythonType::get_type(m_type.get())->ht_type.tp_getset = getSetDefs;
                 for (const auto &member : m_members)
                 {
-                    *members = *member->to_python();
-                    members++;
+                    *getSetDefs = *member->to_python(); //name and doc ownership is passed on to the type.
+                    getSetDefs++;
                 }
-                *members = {NULL, 0, 0, 0, NULL};
+                *getSetDefs = {NULL, NULL, NULL, NULL, NULL};
             }
         }
         static void free_type(PyObject* ptr)
@@ -329,5 +345,6 @@ namespace sweetPy {
         ObjectPtr m_type;
         ClazzContext& m_context;
         bool m_forceInsertion;
+        std::size_t m_freeListCapacity;
     };
 }
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <Python.h>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+
+namespace sweetPy {
+
+    /*
+     * Lock free multi producer single consumer queue of pending decrefs, threads which don't hold the GIL
+     * enqueue their releases instead of acquiring it. Pending releases are drained as a batch upon the next
+     * GilLock acquisition, or by a pending call scheduled once the queue turns non empty.
+     * Both run within the main interpreter, the queue holds main interpreter objects only - a sub interpreter's
+     * object released there would be freed by a foreign interpreter, which per interpreter allocators forbid.
+     */
+    class DecRefQueue
+    {
+    public:
+        typedef std::chrono::nanoseconds Duration;
+
+        static DecRefQueue& instance()
+        {
+            static DecRefQueue queue;
+            return queue;
+        }
+        ~DecRefQueue();
+        DecRefQueue(const DecRefQueue&) = delete;
+        DecRefQueue& operator=(const DecRefQueue&) = delete;
+
+        //Safe to call without holding the GIL.
+        void push(PyObject* object);
+        //Requires the GIL, returns the number of released objects.
+        std::size_t drain();
+        bool has_pending() const { return m_head.load(std::memory_order_relaxed) != nullptr; }
+        std::size_t get_depth() const { return m_depth.load(std::memory_order_relaxed); }
+        std::size_t get_max_depth() const { return m_maxDepth.load(std::memory_order_relaxed); }
+        std::size_t get_enqueued() const { return m_enqueued.load(std::memory_order_relaxed); }
+        std::size_t get_drained() const { return m_drained.load(std::memory_order_relaxed); }
+        std::size_t get_batches() const { return m_batches.load(std::memory_order_relaxed); }
+        //Time the oldest release of the last batch has waited until drained.
+        Duration get_last_drain_latency() const { return Duration(m_lastLatency.load(std::memory_order_relaxed)); }
+        Duration get_max_drain_latency() const { return Duration(m_maxLatency.load(std::memory_order_relaxed)); }
+
+    private:
+        struct Node
+        {
+            PyObject* m_object;
+            Node* m_next;
+            std::chrono::steady_clock::time_point m_enqueued;
+        };
+
+        DecRefQueue();
+        void schedule();
+        static int drain_pending(void*);
+
+    private:
+        std::atomic<Node*> m_head;
+        std::atomic<bool> m_scheduled;
+        std::atomic<std::size_t> m_depth;
+        std::atomic<std::size_t> m_maxDepth;
+        std::atomic<std::size_t> m_enqueued;
+        std::atomic<std::size_t> m_drained;
+        std::atomic<std::size_t> m_batches;
+        std::atomic<Duration::rep> m_lastLatency;
+        std::atomic<Duration::rep> m_maxLatency;
+    };
+}
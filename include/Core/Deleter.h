@@ -1,17 +1,26 @@
 #pragma once
 
 #include <Python.h>
-#include <memory>
-#include <functional>
 #include "Lock.h"
+#include "DecRefQueue.h"
 
 namespace sweetPy {
     struct Deleter {
     public:
         static void Borrow(PyObject *) {}
+        //The GIL is assumed to be held.
         static void Owner(PyObject *obj) {
-            GilLock();
             Py_XDECREF(obj);
         }
+        //For releases from threads which may not hold the GIL, without it the release is deferred to DecRefQueue.
+        //Deferred releases are drained by the main interpreter, handles of other interpreters' objects are not supported.
+        static void GilOwner(PyObject *obj) {
+            if(obj == nullptr)
+                return;
+            if(GilState::get_attached() != nullptr)
+                Py_DECREF(obj);
+            else
+                DecRefQueue::instance().push(obj);
+        }
     };
 }
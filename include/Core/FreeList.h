@@ -0,0 +1,105 @@
+#pragma once
+
+#include <Python.h>
+#include <cstddef>
+#include <new>
+
+namespace sweetPy {
+
+    //Alignment guaranteed by the python object allocator.
+#if PY_VERSION_HEX >= 0x03080000
+    constexpr std::size_t PythonAllocatorAlignment = 16;
+#else
+    constexpr std::size_t PythonAllocatorAlignment = 8;
+#endif
+
+    /*
+     * Bounded cache of released fixed size blocks, blocks are linked through their first word.
+     * Blocks originate from the python object allocator, or from the aligned operator new for alignments
+     * beyond the allocator's guarantee. Access is serialized by the GIL.
+     */
+    class FreeList
+    {
+    public:
+        FreeList():m_head(nullptr), m_capacity(0), m_size(0), m_hits(0), m_misses(0), m_alignment(0) {}
+        ~FreeList() { set_capacity(0); }
+        FreeList(const FreeList&) = delete;
+        FreeList& operator=(const FreeList&) = delete;
+
+        //Blocks retained beyond the new capacity are returned to the allocator.
+        void set_capacity(std::size_t capacity)
+        {
+            m_capacity = capacity;
+            while(m_size > m_capacity)
+                free_block(pop());
+        }
+        //Blocks are aligned to alignment, may only be set while no block is allocated.
+        void set_alignment(std::size_t alignment)
+        {
+            m_alignment = alignment > PythonAllocatorAlignment ? alignment : 0;
+        }
+        std::size_t get_alignment() const { return m_alignment; }
+        void* allocate(std::size_t size)
+        {
+            if(m_head != nullptr)
+            {
+                m_hits++;
+                return pop();
+            }
+            m_misses++;
+            if(m_alignment != 0)
+                return ::operator new(size, std::align_val_t(m_alignment), std::nothrow);
+            return PyObject_Malloc(size);
+        }
+        void release(void* block)
+        {
+            if(m_size == m_capacity)
+            {
+                free_block(block);
+                return;
+            }
+            auto node = static_cast<Block*>(block);
+            node->m_next = m_head;
+            m_head = node;
+            m_size++;
+        }
+        std::size_t get_capacity() const { return m_capacity; }
+        std::size_t get_size() const { return m_size; }
+        std::size_t get_hits() const { return m_hits; }
+        std::size_t get_misses() const { return m_misses; }
+        double get_hit_rate() const
+        {
+            std::size_t total = m_hits + m_misses;
+            return total == 0 ? 0.0 : static_cast<double>(m_hits) / total;
+        }
+
+    private:
+        struct Block
+        {
+            Block* m_next;
+        };
+
+        void free_block(void* block)
+        {
+            if(m_alignment != 0)
+                ::operator delete(block, std::align_val_t(m_alignment));
+            else
+                PyObject_Free(block);
+        }
+        void* pop()
+        {
+            Block* block = m_head;
+            m_head = block->m_next;
+            m_size--;
+            return block;
+        }
+
+    private:
+        Block* m_head;
+        std::size_t m_capacity;
+        std::size_t m_size;
+        std::size_t m_hits;
+        std::size_t m_misses;
+        std::size_t m_alignment;
+    };
+}
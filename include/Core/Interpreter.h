@@ -0,0 +1,81 @@
+#pragma once
+
+#include <Python.h>
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if PY_VERSION_HEX >= 0x03080000
+namespace sweetPy {
+
+    /*
+     * The process's main interpreter, configured through PyConfig ahead of its initialization.
+     * Short lived embedding hosts shorten the startup by an isolated configuration, skipping the site import
+     * and a precomputed sys.path, which spares the search paths calculation. sweetPy modules are registered
+     * as built in modules, imported on demand or eagerly upon initialization.
+     */
+    class Interpreter
+    {
+    public:
+        typedef std::chrono::nanoseconds Duration;
+        typedef PyObject*(*ModuleInit)();
+        struct Timings
+        {
+            Duration m_preInitialization;
+            Duration m_configuration;
+            Duration m_initialization;
+            Duration m_imports;
+            Duration get_total() const { return m_preInitialization + m_configuration + m_initialization + m_imports; }
+        };
+
+        Interpreter();
+        ~Interpreter();
+        Interpreter(const Interpreter&) = delete;
+        Interpreter& operator=(const Interpreter&) = delete;
+
+        //Isolated from the environment variables, the user's site directory and the current directory.
+        void set_isolated(bool isolated){ m_isolated = isolated; }
+        void set_site_import(bool siteImport){ m_siteImport = siteImport; }
+        void set_program_name(const std::string& programName){ m_programName = programName; }
+        //sys.argv, arguments are not parsed as python's command line options.
+        void set_arguments(int argc, char** argv){ m_arguments.assign(argv, argv + argc); }
+        //Replaces the calculated sys.path.
+        void set_search_paths(const std::vector<std::string>& searchPaths)
+        {
+            m_searchPaths = searchPaths;
+            m_searchPathsSet = true;
+        }
+        //Prepended to sys.path once initialized, whether calculated or set.
+        void add_search_path(const std::string& searchPath){ m_addedSearchPaths.emplace_back(searchPath); }
+        //Registers a built in module, its initialization routine is the one defined by INIT_MODULE - PyInit_<name>.
+        void add_module(const std::string& name, ModuleInit init){ m_modules.emplace_back(name, init); }
+        //Imported upon initialization.
+        void add_import(const std::string& name){ m_imports.emplace_back(name); }
+
+        void initialize();
+        void finalize();
+        bool is_initialized() const { return m_initialized; }
+        const Timings& get_timings() const { return m_timings; }
+
+    private:
+        void configure(PyConfig& config);
+        void import_modules();
+        static void verify_status(const PyStatus& status);
+
+    private:
+        bool m_isolated;
+        bool m_siteImport;
+        bool m_searchPathsSet;
+        bool m_initialized;
+        std::string m_programName;
+        std::vector<std::string> m_arguments;
+        std::vector<std::string> m_searchPaths;
+        std::vector<std::string> m_addedSearchPaths;
+        //Names are referred by the inittab until the interpreter is finalized.
+        std::vector<std::pair<std::string, ModuleInit>> m_modules;
+        std::vector<std::string> m_imports;
+        Timings m_timings;
+    };
+}
+#endif
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <Python.h>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "../Types/ObjectPtr.h"
+#include "../Detail/CPythonObject.h"
+#include "Deleter.h"
+#include "Lock.h"
+#include "SPException.h"
+
+namespace sweetPy {
+
+    /*
+     * Pool of isolated sub interpreters for embedding hosts, each interpreter is run by a dedicated thread and
+     * imports sweetPy modules into a copy of its own. Interpreters share the main interpreter's GIL, sweetPy
+     * modules don't declare per interpreter GIL support (Py_mod_multiple_interpreters). Tasks are taken by any
+     * free interpreter and run while holding the GIL. Constructing, destroying and waiting upon the pool's futures
+     * release the calling thread's GIL, the interpreters' threads may require it.
+     * Deleter::GilOwner, and so PreparedCall, is not supported within the pool's interpreters - deferred releases
+     * are drained by the main interpreter. Tasks release their objects through Deleter::Owner ahead of returning.
+     */
+    class InterpreterPool
+    {
+    public:
+        typedef std::function<void()> Task;
+
+        //Requires an initialized main interpreter, bootstrap is run by every interpreter once created.
+        explicit InterpreterPool(std::size_t interpretersCount, const std::string& bootstrap = "");
+        ~InterpreterPool();
+        InterpreterPool(const InterpreterPool&) = delete;
+        InterpreterPool& operator=(const InterpreterPool&) = delete;
+
+        std::size_t get_interpreters_count() const { return m_workers.size(); }
+        //Invokes function within a free interpreter, exceptions thrown by function are delivered through the future.
+        template<typename Function, typename Result = std::invoke_result_t<Function>>
+        std::future<Result> submit(Function&& function)
+        {
+            auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Function>(function));
+            std::future<Result> result = task->get_future();
+            push([task]{ (*task)(); });
+            return result;
+        }
+        //Runs script within the __main__ module of a free interpreter.
+        std::future<void> run(const std::string& script)
+        {
+            return submit([script]{ ObjectPtr result = execute(script, Py_file_input); });
+        }
+        //Evaluates expression within the __main__ module of a free interpreter, converting its result into T.
+        template<typename T>
+        std::future<T> evaluate(const std::string& expression)
+        {
+            return submit([expression]{
+                ObjectPtr result = execute(expression, Py_eval_input);
+                return Object<T>::from_python(result.get());
+            });
+        }
+        //Waits upon future, releasing the calling thread's GIL meanwhile.
+        template<typename T>
+        static T get(std::future<T>& future)
+        {
+            wait(future);
+            return future.get();
+        }
+        template<typename T>
+        static void wait(const std::future<T>& future)
+        {
+            GilRelease release;
+            future.wait();
+        }
+
+    private:
+        void push(Task&& task);
+        void stop();
+        void run_interpreter();
+        void serve(PyThreadState* state);
+        //Python errors are thrown as CPythonException, carrying the error's description.
+        static ObjectPtr execute(const std::string& source, int start);
+
+    private:
+        std::vector<std::thread> m_workers;
+        std::deque<Task> m_tasks;
+        std::mutex m_lock;
+        std::condition_variable m_condition;
+        std::size_t m_started;
+        std::exception_ptr m_startError;
+        std::string m_bootstrap;
+        bool m_stop;
+    };
+}
@@ -1,27 +1,88 @@
 #pragma once
 
 #include <Python.h>
+#include <cstddef>
+#include "DecRefQueue.h"
 
 namespace sweetPy {
 
+    //Per thread GIL bookkeeping, shared by GilLock and GilRelease.
+    struct GilState
+    {
+    public:
+        //Count of the live GilLocks upon the GIL currently held by the thread, reset for the duration of a GilRelease.
+        static inline thread_local std::size_t m_depth = 0;
+        //The sub interpreter's thread state run by the thread, bound by InterpreterPool's threads and by the thread
+        //initializing a sub interpreter's sweetPy module. Threads running sub interpreters otherwise bind their state.
+        static inline thread_local PyThreadState* m_bound = nullptr;
+        static void bind(PyThreadState* state){ m_bound = state; }
+        //The thread state the thread runs python code by, of any interpreter, nullptr when the thread doesn't hold a GIL.
+        static PyThreadState* get_attached()
+        {
+#if PY_VERSION_HEX >= 0x030D0000
+            return PyThreadState_GetUnchecked();
+#elif PY_VERSION_HEX >= 0x030C0000
+            return _PyThreadState_UncheckedGet();
+#else
+            //The current state is process wide, it is the thread's own only if it is one of the thread's states.
+            //Another thread's state is never dereferenced, it may be released concurrently.
+            PyThreadState* state = _PyThreadState_UncheckedGet();
+            if(state == nullptr)
+                return nullptr;
+            return state == m_bound || state == PyGILState_GetThisThreadState() ? state : nullptr;
+#endif
+        }
+    };
+
+    /*
+     * Only the outermost GilLock acquires the GIL, nested ones merely maintain the thread's depth.
+     * The GIL held by a GilLock is to be released only through GilRelease.
+     * PyGILState is bound to the main interpreter, threads running a sub interpreter already hold its GIL
+     * and are left as they are.
+     */
     struct GilLock
     {
     public:
-        GilLock() { m_state = PyGILState_Ensure(); }
-        ~GilLock() { PyGILState_Release(m_state); }
+        GilLock():m_acquired(false), m_state(PyGILState_LOCKED)
+        {
+            if(GilState::m_depth == 0)
+            {
+                PyThreadState* state = GilState::get_attached();
+                if(state == nullptr)
+                {
+                    m_state = PyGILState_Ensure();
+                    m_acquired = true;
+                }
+                //Deferred releases belong to the main interpreter.
+                if(state == nullptr || state->interp == PyInterpreterState_Main())
+                {
+                    DecRefQueue& queue = DecRefQueue::instance();
+                    if(queue.has_pending())
+                        queue.drain();
+                }
+            }
+            GilState::m_depth++;
+        }
+        ~GilLock()
+        {
+            GilState::m_depth--;
+            if(m_acquired)
+                PyGILState_Release(m_state);
+        }
     private:
+        bool m_acquired;
         PyGILState_STATE m_state;
     };
 
     struct GilRelease
     {
     public:
-        GilRelease():m_save(nullptr)
+        GilRelease():m_save(nullptr), m_depth(GilState::m_depth)
         {
-            if(PyGILState_Check() && _PyThreadState_UncheckedGet() != nullptr && m_alreadyReleased == false)
+            if(m_depth > 0 || GilState::get_attached() != nullptr)
             {
                 m_save = PyEval_SaveThread();
-                m_alreadyReleased = true;
+                GilState::m_depth = 0;
             }
         }
         ~GilRelease()
@@ -29,12 +90,16 @@ namespace sweetPy {
             if(m_save)
             {
                 PyEval_RestoreThread(m_save);
-                m_alreadyReleased = false;
+                GilState::m_depth = m_depth;
             }
         }
     private:
-        thread_local static bool m_alreadyReleased;
         PyThreadState* m_save;
+        std::size_t m_depth;
     };
+
+    //Binding policy tag, the bound function's native body is invoked without holding the GIL.
+    struct ReleaseGil{};
+    constexpr ReleaseGil release_gil{};
 }
 
@@ -1,6 +1,9 @@
 #pragma once
 
 #include <Python.h>
+#include <array>
+#include <cstring>
+#include <type_traits>
 #include <utility>
 #include <sstream>
 #include "../Types/Tuple.h"
@@ -61,6 +64,18 @@ namespace sweetPy
             return returnValue;
         }
 
+        //Invokes callable over an arguments vector, whose preceding slot may be borrowed by the callee.
+        static PyObject* vectorcall(PyObject* callable, PyObject* const* args, std::size_t nargs)
+        {
+#if PY_VERSION_HEX >= 0x03090000
+            return PyObject_Vectorcall(callable, args, nargs | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr);
+#elif PY_VERSION_HEX >= 0x03080000
+            return _PyObject_Vectorcall(callable, args, nargs | PY_VECTORCALL_ARGUMENTS_OFFSET, nullptr);
+#else
+            return _PyObject_FastCall(callable, const_cast<PyObject**>(args), static_cast<Py_ssize_t>(nargs));
+#endif
+        }
+
         static void register_on_exit(PyMethodDef& descriptor)
         {
             ObjectPtr cFunction(PyCFunction_NewEx(&descriptor, nullptr, nullptr), &Deleter::Owner);
@@ -100,4 +115,78 @@ namespace sweetPy
             return returnValue;
         }
     };
+
+    template<typename Signature>
+    class PreparedCall;
+
+    /*
+     * A python callable resolved once and invoked many times, for C++ code calling into python per event.
+     * Arguments are converted into a stack allocated vector and passed by vectorcall, no arguments tuple is created.
+     * Arguments are converted as their declared types, reference types are passed as sweetPy reference objects.
+     * The GIL is acquired for the duration of an invocation, the handle may be invoked and released by any thread.
+     * Releases without the GIL are deferred to the main interpreter, calls are bound to the main interpreter's callables.
+     */
+    template<typename R, typename... Args>
+    class PreparedCall<R(Args...)>
+    {
+    public:
+        //Resolves moduleName's functionName, objectName's object is passed as the first argument - as Python::invoke_function does.
+        PreparedCall(const char* moduleName, const char* objectName, const char* functionName)
+            :m_callable(nullptr, &Deleter::GilOwner), m_self(nullptr, &Deleter::GilOwner)
+        {
+            GilLock lock;
+            verify_interpreter();
+            ObjectPtr module(PyImport_ImportModule(moduleName), &Deleter::Owner);
+            CPYTHON_VERIFY_EXC(module.get() != nullptr);
+            m_callable.reset(Python::get_attribute(functionName, module.get()).release());
+            if(std::strcmp(objectName, "") != 0)
+                m_self.reset(Python::get_attribute(objectName, module.get()).release());
+        }
+        explicit PreparedCall(PyObject* callable)
+            :m_callable(nullptr, &Deleter::GilOwner), m_self(nullptr, &Deleter::GilOwner)
+        {
+            CPYTHON_VERIFY(PyCallable_Check(callable), "Received object is not callable");
+            verify_interpreter();
+            Py_INCREF(callable);
+            m_callable.reset(callable);
+        }
+        PreparedCall(const PreparedCall&) = delete;
+        PreparedCall& operator=(const PreparedCall&) = delete;
+        PreparedCall(PreparedCall&&) = default;
+        PreparedCall& operator=(PreparedCall&&) = default;
+
+        R operator()(Args... args) const
+        {
+            GilLock lock;
+            std::array<ObjectPtr, sizeof...(Args)> converted{{ObjectPtr(Object<Args>::to_python(args), &Deleter::Owner)...}};
+            //The first slot is left for the callee's use, the second one holds the bound object if any.
+            PyObject* arguments[sizeof...(Args) + 2] = {nullptr, m_self.get()};
+            for(std::size_t index = 0; index < sizeof...(Args); index++)
+            {
+                CPYTHON_VERIFY_EXC(converted[index].get() != nullptr);
+                arguments[index + 2] = converted[index].get();
+            }
+            std::size_t offset = m_self.get() == nullptr ? 2 : 1;
+            ObjectPtr result(Python::vectorcall(m_callable.get(), arguments + offset, sizeof...(Args) + 2 - offset), &Deleter::Owner);
+            CPYTHON_VERIFY_EXC(result.get() != nullptr);
+            if constexpr(std::is_void<R>::value)
+                return;
+            else if constexpr(std::is_same<R, ObjectPtr>::value)
+                return result;
+            else
+                return Object<R>::from_python(result.get());
+        }
+        PyObject* get_callable() const { return m_callable.get(); }
+
+    private:
+        static void verify_interpreter()
+        {
+            CPYTHON_VERIFY(PyThreadState_Get()->interp == PyInterpreterState_Main(),
+                           "PreparedCall requires the main interpreter, its deferred releases are drained by it");
+        }
+
+    private:
+        ObjectPtr m_callable;
+        ObjectPtr m_self;
+    };
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Python.h>
+#include <string>
 #include "core/Exception.h"
 #include "../Types/ObjectPtr.h"
 #include "Deleter.h"
@@ -18,6 +19,23 @@ namespace sweetPy{
             if(!PyErr_Occurred())
                 PyErr_SetString(m_pyError.get(), m_message.c_str());
         }
+        //Fetches and clears the pending python error, describing it as "<type name>: <value>".
+        static std::string fetch_pending_error()
+        {
+            PyObject *type, *value, *trace;
+            PyErr_Fetch(&type, &value, &trace);
+            if(type == nullptr)
+                return "Unknown error";
+            PyErr_NormalizeException(&type, &value, &trace);
+            ObjectPtr typeGuard(type, &Deleter::Owner), valueGuard(value, &Deleter::Owner), traceGuard(trace, &Deleter::Owner);
+            ObjectPtr description(value != nullptr ? PyObject_Str(value) : nullptr, &Deleter::Owner);
+            const char* text = description.get() != nullptr ? PyUnicode_AsUTF8(description.get()) : nullptr;
+            std::string result = PyType_Check(type) ? reinterpret_cast<PyTypeObject*>(type)->tp_name : "Error";
+            result += ": ";
+            result += text != nullptr ? text : "";
+            PyErr_Clear();
+            return result;
+        }
 
     private:
         ObjectPtr m_pyError;
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+namespace sweetPy {
+
+    /*
+     * Per thread bump allocator of arguments conversion temporaries. A Scope marks the arena upon a call's
+     * entry and rewinds it upon return, releasing every temporary allocated within the call at once.
+     * Chunks are retained across calls, so calls in a steady state don't reach the global heap.
+     */
+    class ScratchArena : public std::pmr::memory_resource
+    {
+    public:
+        class Scope
+        {
+        public:
+            Scope():m_arena(ScratchArena::instance()), m_chunk(m_arena.m_current), m_offset(m_arena.m_offset)
+            {
+                m_arena.m_scopes++;
+            }
+            ~Scope()
+            {
+                m_arena.m_scopes--;
+                m_arena.m_current = m_chunk;
+                m_arena.m_offset = m_offset;
+            }
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+        private:
+            ScratchArena& m_arena;
+            std::size_t m_chunk;
+            std::size_t m_offset;
+        };
+
+        //Within a Suspension temporaries are allocated from the default resource, for ones which outlive the call or are shared with other threads.
+        class Suspension
+        {
+        public:
+            Suspension():m_arena(ScratchArena::instance()), m_scopes(m_arena.m_scopes) { m_arena.m_scopes = 0; }
+            ~Suspension() { m_arena.m_scopes = m_scopes; }
+            Suspension(const Suspension&) = delete;
+            Suspension& operator=(const Suspension&) = delete;
+        private:
+            ScratchArena& m_arena;
+            std::size_t m_scopes;
+        };
+
+        ~ScratchArena() override;
+        ScratchArena(const ScratchArena&) = delete;
+        ScratchArena& operator=(const ScratchArena&) = delete;
+
+        static ScratchArena& instance()
+        {
+            static thread_local ScratchArena arena;
+            return arena;
+        }
+        //The arena within a Scope, the default resource otherwise.
+        static std::pmr::memory_resource* get_resource()
+        {
+            ScratchArena& arena = instance();
+            return arena.m_scopes > 0 ? &arena : std::pmr::get_default_resource();
+        }
+        std::size_t get_chunks_count() const { return m_chunks.size(); }
+        std::size_t get_capacity() const;
+
+    private:
+        struct Chunk
+        {
+            char* m_data;
+            std::size_t m_size;
+        };
+        static constexpr std::size_t InitialChunkSize = 4096;
+
+        ScratchArena():m_current(0), m_offset(0), m_scopes(0){}
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            if(m_current < m_chunks.size())
+            {
+                Chunk& chunk = m_chunks[m_current];
+                std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(chunk.m_data);
+                std::uintptr_t address = (begin + m_offset + alignment - 1) & ~(std::uintptr_t(alignment) - 1);
+                if(address + bytes <= begin + chunk.m_size)
+                {
+                    m_offset = address + bytes - begin;
+                    return reinterpret_cast<void*>(address);
+                }
+            }
+            return allocate_chunk(bytes, alignment);
+        }
+        //Memory is reclaimed only once the owning Scope ends.
+        void do_deallocate(void*, std::size_t, std::size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+        void* allocate_chunk(std::size_t bytes, std::size_t alignment);
+
+    private:
+        std::vector<Chunk> m_chunks;
+        std::size_t m_current;
+        std::size_t m_offset;
+        std::size_t m_scopes;
+    };
+}
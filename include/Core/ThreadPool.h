@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sweetPy {
+
+    /*
+     * Persistent pool of native workers, each worker owns a tasks queue and steals from the
+     * other queues once its own is exhausted. Tasks must not use the python API.
+     */
+    class ThreadPool
+    {
+    public:
+        typedef std::function<void()> Task;
+        typedef std::function<void(std::size_t)> Body;
+
+        explicit ThreadPool(std::size_t workersCount);
+        ~ThreadPool();
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        static ThreadPool& instance();
+        std::size_t get_workers_count() const { return m_workers.size(); }
+        void submit(Task&& task);
+        /*
+         * Invokes body over [0, count) using up to concurrency threads, the calling thread included,
+         * and returns once all indices were processed. The first exception thrown by body is rethrown.
+         */
+        void parallel_for(std::size_t count, std::size_t concurrency, const Body& body);
+
+    private:
+        struct WorkerQueue
+        {
+            std::mutex m_lock;
+            std::deque<Task> m_tasks;
+        };
+        void run(std::size_t index);
+        bool pop(std::size_t index, Task& task);
+        bool steal(std::size_t index, Task& task);
+
+    private:
+        std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+        std::vector<std::thread> m_workers;
+        std::mutex m_lock;
+        std::condition_variable m_condition;
+        std::size_t m_pending;
+        bool m_stop;
+        std::atomic<std::size_t> m_nextQueue;
+    };
+}
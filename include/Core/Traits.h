@@ -1,6 +1,7 @@
 #pragma once
 
 #include <type_traits>
+#include <memory_resource>
 #include <vector>
 #include <tuple>
 
@@ -83,4 +84,5 @@ namespace sweetPy{
     
     template<typename T> struct is_container : public std::false_type{};
     template<typename T> struct is_container<std::vector<T>> : public std::true_type{};
+    template<typename T> struct is_container<std::pmr::vector<T>> : public std::true_type{};
 }
@@ -1,16 +1,30 @@
 #pragma once
+
+#include <cstddef>
+#include <typeinfo>
+
 namespace sweetPy{
     struct Hash
     {
     private:
         template<typename T>
-        struct _Hash{};
+        struct _Hash
+        {
+            static inline const char m_tag = 0;
+        };
         
     public:
+        //Stable across runs and shared objects, keys the types registry and names the generated types.
         template<typename T>
         static std::size_t generate_hash_code()
         {
             return typeid(_Hash<T>).hash_code();
         }
+        //The address of a per type static tag, resolved at link time. Compared by the instances' type probe only.
+        template<typename T>
+        static std::size_t generate_tag()
+        {
+            return reinterpret_cast<std::size_t>(&_Hash<T>::m_tag);
+        }
     };
 }
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <Python.h>
+#include <memory_resource>
+#include <string>
+#include <vector>
+#include <type_traits>
+#include "../Core/Traits.h"
+#include "../Core/Utils.h"
+#include "../Types/ObjectPtr.h"
+#include "../Types/AsciiString.h"
+#include "../Types/DateTime.h"
+#include "../Types/TimeDelta.h"
+#include "../Types/Tuple.h"
+#include "../Types/List.h"
+#include "../Types/Dictionary.h"
+#include "Object.h"
+
+namespace sweetPy {
+
+    /*
+     * Decides whether a python object is an acceptable origin for a native argument type,
+     * the decision depends solely upon the object's type and mirrors Object<T>::get_typed.
+     * Used by overload resolution, conversion still validates the argument.
+     */
+    template<typename T, typename = void>
+    struct NativeTypeMatcher
+    {
+        static bool match(PyObject* object){ return false; }
+    };
+
+    //Integral types accept python ints, bool included, conversion checks the value's range.
+    template<typename T>
+    struct NativeTypeMatcher<T, enable_if_t<std::is_integral<T>::value>>
+    {
+        static bool match(PyObject* object){ return PyLong_Check(object); }
+    };
+
+    template<typename T>
+    struct NativeTypeMatcher<T, enable_if_t<std::is_same<T, double>::value>>
+    {
+        static bool match(PyObject* object){ return Py_TYPE(object) == &PyFloat_Type || Py_TYPE(object) == &PyLong_Type; }
+    };
+
+    template<typename T>
+    struct NativeTypeMatcher<T, enable_if_t<std::is_same<T, std::string>::value || std::is_same<T, std::pmr::string>::value ||
+                                            std::is_same<T, const char*>::value>>
+    {
+        static bool match(PyObject* object){ return PyUnicode_CheckExact(object) || PyBytes_CheckExact(object); }
+    };
+
+    template<typename T>
+    struct NativeTypeMatcher<T, enable_if_t<std::is_same<T, AsciiString>::value>>
+    {
+        static bool match(PyObject* object){ return PyUnicode_CheckExact(object); }
+    };
+
+    template<typename T>
+    struct NativeTypeMatcher<T, enable_if_t<std::is_same<T, char*>::value>>
+    {
+        static bool match(PyObject* object){ return PyBytes_CheckExact(object); }
+    };
+
+    template<typename T>
+    struct NativeTypeMatcher<T, enable_if_t<std::is_same<T, PyObject*>::value || std::is_same<T, ObjectPtr>::value ||
+                                            std::is_same<T, DateTime>::value || std::is_same<T, TimeDelta>::value ||
+                                            std::is_enum<T>::value>>
+    {
+        static bool match(PyObject* object){ return true; }
+    };
+
+    template<typename T>
+    struct NativeTypeMatcher<std::vector<T>>
+    {
+        static bool match(PyObject* object){ return PyList_Check(object); }
+    };
+
+    template<typename T>
+    struct NativeTypeMatcher<std::pmr::vector<T>>
+    {
+        static bool match(PyObject* object){ return PyList_Check(object); }
+    };
+
+    template<>
+    struct NativeTypeMatcher<List>
+    {
+        static bool match(PyObject* object){ return PyList_Check(object); }
+    };
+
+    template<>
+    struct NativeTypeMatcher<Tuple>
+    {
+        static bool match(PyObject* object){ return PyTuple_Check(object); }
+    };
+
+    template<>
+    struct NativeTypeMatcher<Dictionary>
+    {
+        static bool match(PyObject* object){ return PyDict_Check(object); }
+    };
+
+    template<typename T>
+    struct ArgumentMatcher
+    {
+        typedef typename std::remove_cv<typename std::decay<T>::type>::type Type;
+
+        static bool match(PyObject* object)
+        {
+            return NativeTypeMatcher<Type>::match(object) || Instance<Type>::get_category(object) != TypeCategory::Foreign;
+        }
+    };
+
+    template<typename... Args>
+    struct ArgumentsMatcher
+    {
+        static bool match(PyObject* const* args, Py_ssize_t nargs)
+        {
+            if(nargs != static_cast<Py_ssize_t>(sizeof...(Args)))
+                return false;
+            Py_ssize_t index = 0;
+            (void)index;
+            return (true && ... && ArgumentMatcher<Args>::match(args[index++]));
+        }
+    };
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <Python.h>
+#include <algorithm>
+#include <array>
+#include <utility>
+#include "core/Source.h"
+#include "../Core/Traits.h"
+#include "../Core/SPException.h"
+#include "../Core/Assert.h"
+#include "CPythonObject.h"
+
+#if PY_VERSION_HEX >= 0x03070000
+#define SWEETPY_FASTCALL_SUPPORT
+#endif
+
+namespace sweetPy {
+
+    template<typename FromPythonType>
+    struct PythonArgument{};
+
+    template<>
+    struct PythonArgument<PyObject*>
+    {
+        static void* set(char* buffer, PyObject* object)
+        {
+            new(buffer)PyObject*(object);
+            return nullptr;
+        }
+    };
+
+    template<>
+    struct PythonArgument<long>
+    {
+        static void* set(char* buffer, PyObject* object)
+        {
+            if(PyFloat_Check(object))
+                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "integer argument expected, got float");
+            long value = PyLong_AsLong(object);
+            if(value == -1 && PyErr_Occurred())
+                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Invalid argument was provided");
+            new(buffer)long(value);
+            return nullptr;
+        }
+    };
+
+    template<typename... Args>
+    struct ArgumentsFormat
+    {
+        static constexpr std::size_t length()
+        {
+            const char* formats[] = {Object<Args>::Format..., ""};
+            std::size_t length = 0;
+            for(const char* format : formats)
+                while(*format++ != '\0')
+                    length++;
+            return length;
+        }
+
+        static constexpr std::array<char, length() + 1> generate()
+        {
+            const char* formats[] = {Object<Args>::Format..., ""};
+            std::array<char, length() + 1> value{};
+            std::size_t index = 0;
+            for(const char* format : formats)
+                while(*format != '\0')
+                    value[index++] = *format++;
+            return value;
+        }
+
+        static constexpr std::array<char, length() + 1> Value = generate();
+    };
+
+    template<typename... Args>
+    struct ArgumentsParser
+    {
+        typedef std::array<int, std::max<std::size_t>(1, sizeof...(Args))> OffsetsTable;
+        static constexpr int PythonArgsSize = std::max(1, ObjectsPackSize<typename Object<Args>::FromPythonType...>::value);
+        static constexpr int NativeArgsSize = std::max(1, ObjectsPackSize<typename Object<Args>::Type...>::value);
+        static constexpr Py_ssize_t ArgsCount = sizeof...(Args);
+
+        template<std::size_t... I>
+        static constexpr OffsetsTable generate_offsets(OffsetType type, std::index_sequence<I...>)
+        {
+            return type == FromPython ?
+                OffsetsTable{ObjectOffset<FromPython, ObjectWrapper<Args, I>, ObjectWrapper<Args, I>...>::value...} :
+                OffsetsTable{ObjectOffset<ToNative, ObjectWrapper<Args, I>, ObjectWrapper<Args, I>...>::value...};
+        }
+
+        //Per signature layout of both arguments buffers, generated once per instantiation.
+        static constexpr OffsetsTable PythonOffsets = generate_offsets(FromPython, std::make_index_sequence<sizeof...(Args)>{});
+        static constexpr OffsetsTable NativeOffsets = generate_offsets(ToNative, std::make_index_sequence<sizeof...(Args)>{});
+
+        //Arguments tuple, decoded by python's own parser.
+        template<std::size_t... I>
+        static void parse(PyObject* args, char* pythonArgsBuffer, std::index_sequence<I...>)
+        {
+            CPYTHON_VERIFY(PyArg_ParseTuple(args, ArgumentsFormat<Args...>::Value.data(), (pythonArgsBuffer + PythonOffsets[I])...),
+                           "Invalid argument was provided");
+        }
+
+        //Arguments vector, each argument is written directly into its python representation slot.
+        template<std::size_t... I>
+        static void parse(PyObject* const* args, Py_ssize_t nargs, char* pythonArgsBuffer, std::index_sequence<I...>)
+        {
+            if(nargs != ArgsCount)
+                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "function takes exactly %d arguments (%d given)",
+                                       (int)ArgsCount, (int)nargs);
+
+            invoker(PythonArgument<typename Object<Args>::FromPythonType>::set(pythonArgsBuffer + PythonOffsets[I], args[I])...);
+        }
+
+        template<std::size_t... I>
+        static void destroy(char* nativeArgsBuffer, std::index_sequence<I...>)
+        {
+            invoker(ObjectWrapper<Args, I>::destructor(nativeArgsBuffer + NativeOffsets[I])...);
+        }
+    };
+}
@@ -2,7 +2,9 @@
 
 #include <Python.h>
 #include <cstdint>
+#include <limits>
 #include <datetime.h>
+#include <memory_resource>
 #include <string>
 #include <vector>
 #include <type_traits>
@@ -12,6 +14,7 @@
 #include "../Core/Lock.h"
 #include "../Core/Assert.h"
 #include "../Core/Deleter.h"
+#include "../Core/ScratchArena.h"
 #include "TypesContainer.h"
 #include "CPythonEnumValue.h"
 #include "CPythonType.h"
@@ -22,12 +25,25 @@ namespace sweetPy{
     class Module;
     static std::uint32_t MAGIC_WORD = 0xABBACDDC;
 
+    //In place ASCII content of a python unicode string, non ASCII content raises as upon ASCII encoding.
+    inline const char* get_ascii_data(PyObject* unicode, Py_ssize_t& size)
+    {
+        CPYTHON_VERIFY_EXC(PyUnicode_READY(unicode) == 0);
+        if(PyUnicode_IS_ASCII(unicode) == false)
+        {
+            ObjectPtr bytesObject(PyUnicode_AsASCIIString(unicode), &Deleter::Owner);
+            CPYTHON_VERIFY_EXC(bytesObject.get() != nullptr);
+        }
+        size = PyUnicode_GET_LENGTH(unicode);
+        return static_cast<const char*>(PyUnicode_DATA(unicode));
+    }
+
     template<typename T, typename = void>
     struct Object{};
 
     template<typename T>
     struct Object<T, enable_if_t<!std::is_pointer<T>::value && !is_container<T>::value && std::is_copy_constructible<T>::value &&
-                                             !std::is_enum<T>::value && !std::is_reference<T>::value>> {
+                                             !std::is_enum<T>::value && !std::is_reference<T>::value && !std::is_integral<T>::value>> {
     public:
         typedef PyObject* FromPythonType;
         typedef T Type;
@@ -35,50 +51,14 @@ namespace sweetPy{
         static const bool IsSimpleObjectType = true;
         static T get_typed(char* fromBuffer, char* toBuffer)
         {
-            PyObject* object = *reinterpret_cast<PyObject**>(fromBuffer);
-            if(ClazzObject<ReferenceObject<T>>::is_ref(object))
-            {
-                ReferenceObject<T>& refObject = ClazzObject<ReferenceObject<T>>::get_val(object);
-                return refObject.get_ref();
-            }
-            else if(ClazzObject<ReferenceObject<const T>>::is_ref(object))
-            {
-                ReferenceObject<const T>& refObject = ClazzObject<ReferenceObject<const T>>::get_val(object);
-                return refObject.get_ref();
-            }
-            else if(ClazzObject<T>::is_val(object))
-            {
-                return ClazzObject<T>::get_val(object);
-            }
-            else if(ClazzObject<const T>::is_val(object))
-            {
-                return ClazzObject<const T>::get_val(object);
-            }
-            else
-                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Non supported type");
+            return from_python(*reinterpret_cast<PyObject**>(fromBuffer));
         }
         static T from_python(PyObject* object)
         {
-            if(ClazzObject<ReferenceObject<T>>::is_ref(object))
-            {
-                ReferenceObject<T>& refObject = ClazzObject<ReferenceObject<T>>::get_val(object);
-                return refObject.get_ref();
-            }
-            else if(ClazzObject<ReferenceObject<const T>>::is_ref(object))
-            {
-                ReferenceObject<const T>& refObject = ClazzObject<ReferenceObject<const T>>::get_val(object);
-                return refObject.get_ref();
-            }
-            else if(ClazzObject<T>::is_val(object))
-            {
-                return ClazzObject<T>::get_val(object);
-            }
-            else if(ClazzObject<const T>::is_val(object))
-            {
-                return ClazzObject<const T>::get_val(object);
-            }
-            else
+            auto value = Instance<T>::get(object, Instance<T>::get_category(object));
+            if(value == nullptr)
                 throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Non supported type");
+            return *value;
         }
         template<typename X = Type, typename = enable_if_t<std::is_copy_constructible<X>::value>>
         static PyObject* to_python(T& value)
@@ -110,34 +90,14 @@ namespace sweetPy{
         static T get_typed(char* fromBuffer, char* toBuffer) //Non python types representation - PyPbject Header + Native data
         {
             new(toBuffer)std::uint32_t(MAGIC_WORD);
-            PyObject* object = *reinterpret_cast<PyObject**>(fromBuffer);
-            if(ClazzObject<ReferenceObject<T>>::is_ref(object))
-            {
-                ReferenceObject<T>& refObject = ClazzObject<ReferenceObject<T>>::get_val(object);
-                return std::move(refObject.get_ref());
-            }
-            else if(ClazzObject<T>::is_val(object))
-            {
-                auto& value = ClazzObject<T>::get_val(object);
-                return std::move(value);
-            }
-            else
-                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Non supported type");
+            return from_python(*reinterpret_cast<PyObject**>(fromBuffer));
         }
         static T from_python(PyObject* object)
         {
-            if(ClazzObject<ReferenceObject<T>>::is_ref(object))
-            {
-                ReferenceObject<T>& refObject = ClazzObject<ReferenceObject<T>>::get_val(object);
-                return refObject.get_ref();
-            }
-            else if(ClazzObject<T>::is_val(object))
-            {
-                auto& value = ClazzObject<T>::get_val(object);
-                return std::move(value);
-            }
-            else
+            TypeCategory category = Instance<T>::get_category(object);
+            if(category == TypeCategory::Foreign || Instance<T>::is_const(category))
                 throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Non supported type");
+            return std::move(*Instance<T>::get(object, category));
         }
         template<typename X = T, typename = enable_if_t<std::is_move_constructible<X>::value>>
         static PyObject* to_python(T&& value)
@@ -174,40 +134,16 @@ namespace sweetPy{
         static const bool IsSimpleObjectType = false;
         static T& get_typed(char* fromBuffer, char* toBuffer)
         {
-            PyObject* object = *reinterpret_cast<PyObject**>(fromBuffer);
-            if(ClazzObject<ReferenceObject<T>>::is_ref(object))
-            {
-                ReferenceObject<T>& refObject = ClazzObject<ReferenceObject<T>>::get_val(object);
-                return refObject.get_ref();
-            }
-            else if(ClazzObject<T>::is_val(object))
-            {
-                return ClazzObject<T>::get_val(object);
-            }
-            else
-                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Non supported type");
+            return from_python(*reinterpret_cast<PyObject**>(fromBuffer));
         }
         static T& from_python(PyObject* object)
         {
-            if(ClazzObject<ReferenceObject<T>>::is_ref(object))
-            {
-                ReferenceObject<T>& refObject = ClazzObject<ReferenceObject<T>>::get_val(object);
-                return refObject.get_ref();
-            }
-            else if(ClazzObject<T>::is_val(object))
-            {
-                return ClazzObject<T>::get_val(object);
-            }
-            else if(ClazzObject<ReferenceObject<T const>>::is_ref(object))
-            {
-                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Piercing const modifier,");
-            }
-            else if(ClazzObject<T const>::is_val(object))
-            {
-                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Piercing const modifier,");
-            }
-            else
+            TypeCategory category = Instance<T>::get_category(object);
+            if(category == TypeCategory::Foreign)
                 throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Non supported type");
+            if(Instance<T>::is_const(category))
+                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Piercing const modifier,");
+            return *Instance<T>::get(object, category);
         }
         static PyObject* to_python(T& value)
         {
@@ -224,50 +160,14 @@ namespace sweetPy{
         static const bool IsSimpleObjectType = false;
         static const T& get_typed(char* fromBuffer, char* toBuffer)
         {
-            PyObject* object = *reinterpret_cast<PyObject**>(fromBuffer);
-            if(ClazzObject<ReferenceObject<T>>::is_ref(object))
-            {
-                ReferenceObject<T>& refObject = ClazzObject<ReferenceObject<T>>::get_val(object);
-                return refObject.get_ref();
-            }
-            else if(ClazzObject<ReferenceObject<const T>>::is_ref(object))
-            {
-                ReferenceObject<const T>& refObject = ClazzObject<ReferenceObject<const T>>::get_val(object);
-                return refObject.get_ref();
-            }
-            else if(ClazzObject<T>::is_val(object))
-            {
-                return ClazzObject<T>::get_val(object);
-            }
-            else if(ClazzObject<const T>::is_val(object))
-            {
-                return ClazzObject<const T>::get_val(object);
-            }
-            else
-                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Non supported type");
+            return from_python(*reinterpret_cast<PyObject**>(fromBuffer));
         }
         static const T& from_python(PyObject* object)
         {
-            if(ClazzObject<ReferenceObject<T>>::is_ref(object))
-            {
-                ReferenceObject<T>& refObject = ClazzObject<ReferenceObject<T>>::get_val(object);
-                return refObject.get_ref();
-            }
-            else if(ClazzObject<ReferenceObject<const T>>::is_ref(object))
-            {
-                ReferenceObject<const T>& refObject = ClazzObject<ReferenceObject<const T>>::get_val(object);
-                return refObject.get_ref();
-            }
-            else if(ClazzObject<T>::is_val(object))
-            {
-                return ClazzObject<T>::get_val(object);
-            }
-            else if(ClazzObject<const T>::is_val(object))
-            {
-                return ClazzObject<const T>::get_val(object);
-            }
-            else
+            auto value = Instance<T>::get(object, Instance<T>::get_category(object));
+            if(value == nullptr)
                 throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Non supported type");
+            return *value;
         }
         static PyObject* to_python(const T& value)
         {
@@ -286,32 +186,14 @@ namespace sweetPy{
         static const bool IsSimpleObjectType = false;
         static T&& get_typed(char* fromBuffer, char* toBuffer)
         {
-            PyObject* object = *reinterpret_cast<PyObject**>(fromBuffer);
-            if(ClazzObject<ReferenceObject<T>>::is_ref(object))
-            {
-                ReferenceObject<T>& refObject = ClazzObject<ReferenceObject<T>>::get_val(object);
-                return std::move(refObject.get_ref());
-            }
-            else if(ClazzObject<T>::is_val(object))
-            {
-                return std::move(ClazzObject<T>::get_val(object));
-            }
-            else
-                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Non supported type");
+            return from_python(*reinterpret_cast<PyObject**>(fromBuffer));
         }
         static T&& from_python(PyObject* object)
         {
-            if(ClazzObject<ReferenceObject<T>>::is_ref(object))
-            {
-                ReferenceObject<T>& refObject = ClazzObject<ReferenceObject<T>>::get_val(object);
-                return std::move(refObject.get_ref());
-            }
-            else if(ClazzObject<T>::is_val(object))
-            {
-                return std::move(ClazzObject<T>::get_val(object));
-            }
-            else
+            TypeCategory category = Instance<T>::get_category(object);
+            if(category == TypeCategory::Foreign || Instance<T>::is_const(category))
                 throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Non supported type");
+            return std::move(*Instance<T>::get(object, category));
         }
         //No meaning to return rvalue reference to python (only supports lvalue value category), so ToPython is not implemented.
     };
@@ -510,14 +392,9 @@ namespace sweetPy{
             }
             else if(Py_TYPE(object) == &PyUnicode_Type)
             {
-                ObjectPtr bytesObject(PyUnicode_AsASCIIString(object), &Deleter::Owner);
-                CPYTHON_VERIFY_EXC(bytesObject.get() != nullptr);
-                char* buffer = PyBytes_AsString(bytesObject.get());
-                std::size_t size = strlen(buffer) + 1;
-                char*& copyTo = *reinterpret_cast<char**>(toBuffer);
-                copyTo = new char[size];
-                std::memcpy(copyTo, buffer, size);
-                return copyTo;
+                //Provided in place, the argument outlives the call.
+                Py_ssize_t size = 0;
+                return get_ascii_data(object, size);
             }
             else if(ClazzObject<ReferenceObject<const char*>>::is_ref(object))
             {
@@ -609,25 +486,19 @@ namespace sweetPy{
         {
             static_assert(sizeof(Type) >= sizeof(std::uint32_t), "Not enough space to initialize magic word");
             PyObject* object = *(PyObject**)fromBuffer;
+            //Both are provided in place, the argument outlives the call.
             if(Py_TYPE(object) == &PyBytes_Type)
             {
-                char* buffer = PyBytes_AsString(object);
-                std::size_t size = strlen(buffer) + 1;
-                char*& copyTo = *reinterpret_cast<char**>(toBuffer);
-                copyTo = new char[size];
-                std::memcpy(copyTo, buffer, size);
-                return const_cast<char const *&>(copyTo);
+                const char*& data = *reinterpret_cast<const char**>(toBuffer);
+                data = PyBytes_AsString(object);
+                return data;
             }
             else if(Py_TYPE(object) == &PyUnicode_Type)
             {
-                ObjectPtr bytesObject(PyUnicode_AsASCIIString(object), &Deleter::Owner);
-                CPYTHON_VERIFY_EXC(bytesObject.get() != nullptr);
-                char* buffer = PyBytes_AsString(bytesObject.get());
-                std::size_t size = strlen(buffer) + 1;
-                char*& copyTo = *reinterpret_cast<char**>(toBuffer);
-                copyTo = new char[size];
-                std::memcpy(copyTo, buffer, size);
-                return const_cast<char const *&>(copyTo);
+                Py_ssize_t size = 0;
+                const char*& data = *reinterpret_cast<const char**>(toBuffer);
+                data = get_ascii_data(object, size);
+                return data;
             }
             else if(ClazzObject<ReferenceObject<const char*>>::is_ref(object))
             {
@@ -817,9 +688,9 @@ namespace sweetPy{
             PyObject* object = *(PyObject**)fromBuffer;
             if(Py_TYPE(object) == &PyUnicode_Type)
             {
-                ObjectPtr bytesObject(PyUnicode_AsASCIIString(object), &Deleter::Owner);
-                CPYTHON_VERIFY_EXC(bytesObject.get() != nullptr);
-                new(toBuffer)std::string(PyBytes_AsString(bytesObject.get()));
+                Py_ssize_t size = 0;
+                const char* data = get_ascii_data(object, size);
+                new(toBuffer)std::string(data, size);
                 return *reinterpret_cast<std::string*>(toBuffer);
             }
             else if(Py_TYPE(object) == &PyBytes_Type)
@@ -848,9 +719,9 @@ namespace sweetPy{
             GilLock lock;
             if(Py_TYPE(object) == &PyUnicode_Type)
             {
-                ObjectPtr bytesObject(PyUnicode_AsASCIIString(object), &Deleter::Owner);
-                CPYTHON_VERIFY_EXC(bytesObject.get() != nullptr);
-                return std::string(PyBytes_AsString(bytesObject.get()));
+                Py_ssize_t size = 0;
+                const char* data = get_ascii_data(object, size);
+                return std::string(data, size);
             }
             else if(Py_TYPE(object) == &PyBytes_Type)
             {
@@ -890,9 +761,9 @@ namespace sweetPy{
             PyObject* object = *(PyObject**)fromBuffer;
             if(Py_TYPE(object) == &PyUnicode_Type)
             {
-                ObjectPtr bytesObject(PyUnicode_AsASCIIString(object), &Deleter::Owner);
-                CPYTHON_VERIFY_EXC(bytesObject.get() != nullptr);
-                new(toBuffer)std::string(PyBytes_AsString(bytesObject.get()));
+                Py_ssize_t size = 0;
+                const char* data = get_ascii_data(object, size);
+                new(toBuffer)std::string(data, size);
                 return *reinterpret_cast<std::string*>(toBuffer);
             }
             else if(Py_TYPE(object) == &PyBytes_Type)
@@ -988,9 +859,9 @@ namespace sweetPy{
             PyObject* object = *(PyObject**)fromBuffer;
             if(Py_TYPE(object) == &PyUnicode_Type)
             {
-                ObjectPtr bytesObject(PyUnicode_AsASCIIString(object), &Deleter::Owner);
-                CPYTHON_VERIFY_EXC(bytesObject.get() != nullptr);
-                new(toBuffer)std::string(PyBytes_AsString(bytesObject.get()));
+                Py_ssize_t size = 0;
+                const char* data = get_ascii_data(object, size);
+                new(toBuffer)std::string(data, size);
                 return std::move(*reinterpret_cast<std::string*>(toBuffer));
             }
             else if(Py_TYPE(object) == &PyBytes_Type)
@@ -1018,6 +889,166 @@ namespace sweetPy{
         }
     };
 
+    //Polymorphic allocator strings and vectors, ones bound by const reference are allocated from the call's ScratchArena.
+    template<>
+    struct Object<std::pmr::string>
+    {
+    public:
+        typedef PyObject* FromPythonType;
+        typedef std::pmr::string Type;
+        static constexpr const char *Format = "O";
+        static const bool IsSimpleObjectType = false;
+        static std::pmr::string get_typed(char* fromBuffer, char* toBuffer)
+        {
+            PyObject* object = *(PyObject**)fromBuffer;
+            new(toBuffer)std::uint32_t(MAGIC_WORD); //Returned by value, no temporary is kept.
+            return from_python(object);
+        }
+        static std::pmr::string from_python(PyObject* object, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        {
+            GilLock lock;
+            if(Py_TYPE(object) == &PyUnicode_Type)
+            {
+                Py_ssize_t size = 0;
+                const char* data = get_ascii_data(object, size);
+                return std::pmr::string(data, size, resource);
+            }
+            else if(Py_TYPE(object) == &PyBytes_Type)
+                return std::pmr::string(PyBytes_AS_STRING(object), PyBytes_GET_SIZE(object), resource);
+            else
+                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "std::pmr::string can only originates from python's unicode string or bytes array");
+        }
+        static PyObject* to_python(const std::pmr::string& value)
+        {
+            return PyBytes_FromStringAndSize(value.c_str(), value.size());
+        }
+    };
+
+    template<>
+    struct Object<const std::pmr::string&>
+    {
+    public:
+        typedef PyObject* FromPythonType;
+        typedef std::pmr::string Type;
+        static constexpr const char *Format = "O";
+        static const bool IsSimpleObjectType = false;
+        static const std::pmr::string& get_typed(char* fromBuffer, char* toBuffer)
+        {
+            PyObject* object = *(PyObject**)fromBuffer;
+            return *new(toBuffer)std::pmr::string(Object<std::pmr::string>::from_python(object, ScratchArena::get_resource()));
+        }
+    };
+
+    template<typename T>
+    struct Object<std::pmr::vector<T>>
+    {
+    public:
+        typedef PyObject* FromPythonType;
+        typedef std::pmr::vector<T> Type;
+        static const bool IsSimpleObjectType = false;
+        static constexpr const char *Format = "O";
+        static std::pmr::vector<T> get_typed(char* fromBuffer, char* toBuffer)
+        {
+            PyObject* object = *reinterpret_cast<PyObject**>(fromBuffer);
+            new(toBuffer)std::uint32_t(MAGIC_WORD); //Returned by value, no temporary is kept.
+            return from_python(object);
+        }
+        static std::pmr::vector<T> from_python(PyObject* object, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        {
+            GilLock lock;
+            if(Py_TYPE(object) != &PyList_Type)
+                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "std::pmr::vector can only originates from python list type");
+            Py_ssize_t numOfElements = PyList_GET_SIZE(object);
+            std::pmr::vector<T> vectorObject(resource);
+            vectorObject.reserve(numOfElements);
+            for(Py_ssize_t index = 0; index < numOfElements; index++)
+            {
+                PyObject* element = PyList_GET_ITEM(object, index);
+                if constexpr(std::is_same<T, std::pmr::string>::value)
+                    vectorObject.emplace_back(Object<T>::from_python(element, resource));
+                else
+                    vectorObject.emplace_back(Object<T>::from_python(element));
+            }
+            return vectorObject;
+        }
+        static PyObject* to_python(const std::pmr::vector<T>& object)
+        {
+            PyObject* pyListObject = PyList_New(object.size());
+            for(std::size_t index = 0; index < object.size(); index++)
+                PyList_SetItem(pyListObject, index, Object<T>::to_python(object[index]));
+            return pyListObject;
+        }
+    };
+
+    template<typename T>
+    struct Object<const std::pmr::vector<T>&>
+    {
+    public:
+        typedef PyObject* FromPythonType;
+        typedef std::pmr::vector<T> Type;
+        static const bool IsSimpleObjectType = false;
+        static constexpr const char *Format = "O";
+        static const std::pmr::vector<T>& get_typed(char* fromBuffer, char* toBuffer)
+        {
+            PyObject* object = *reinterpret_cast<PyObject**>(fromBuffer);
+            return *new(toBuffer)std::pmr::vector<T>(Object<Type>::from_python(object, ScratchArena::get_resource()));
+        }
+    };
+
+    //Integral types other than int and bool, parsed from a python int and range checked against T.
+    template<typename T>
+    struct Object<T, enable_if_t<std::is_integral<T>::value && !std::is_same<T, int>::value && !std::is_same<T, bool>::value>>
+    {
+    public:
+        typedef PyObject* FromPythonType;
+        typedef T Type;
+        static constexpr const char *Format = "O";
+        static const bool IsSimpleObjectType = false;
+        static T& get_typed(char* fromBuffer, char* toBuffer)
+        {
+            new(toBuffer)T(convert(*reinterpret_cast<PyObject**>(fromBuffer)));
+            return *reinterpret_cast<T*>(toBuffer);
+        }
+        static T from_python(PyObject* object)
+        {
+            GilLock lock;
+            return convert(object);
+        }
+        static PyObject* to_python(const T& data)
+        {
+            if(std::is_signed<T>::value)
+                return PyLong_FromLongLong(static_cast<long long>(data));
+            return PyLong_FromUnsignedLongLong(static_cast<unsigned long long>(data));
+        }
+
+    private:
+        static T convert(PyObject* object)
+        {
+            if(!PyLong_Check(object))
+                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Integral conversion requires a python int");
+            bool inRange;
+            T value;
+            if constexpr(std::is_signed<T>::value)
+            {
+                long long parsed = PyLong_AsLongLong(object);
+                inRange = !(parsed == -1 && PyErr_Occurred()) && parsed >= std::numeric_limits<T>::min() && parsed <= std::numeric_limits<T>::max();
+                value = static_cast<T>(parsed);
+            }
+            else
+            {
+                unsigned long long parsed = PyLong_AsUnsignedLongLong(object);
+                inRange = !(parsed == static_cast<unsigned long long>(-1) && PyErr_Occurred()) && parsed <= std::numeric_limits<T>::max();
+                value = static_cast<T>(parsed);
+            }
+            if(!inRange)
+            {
+                PyErr_Clear();
+                throw CPythonException(PyExc_OverflowError, __CORE_SOURCE, "Python int is out of the integral type's range");
+            }
+            return value;
+        }
+    };
+
     template<>
     struct Object<bool>
     {
@@ -1260,7 +1291,7 @@ namespace sweetPy{
         static const bool IsSimpleObjectType = false;
         static int get_typed(char* fromBuffer, char* toBuffer){
             PyObject* object = *(PyObject**)fromBuffer;
-            if(Py_TYPE(object) == &PyLong_Type)
+            if(PyLong_Check(object))
             {
                 new(toBuffer)int(PyLong_AsLongLong(object));
                 return *reinterpret_cast<int*>(toBuffer);
@@ -1282,7 +1313,7 @@ namespace sweetPy{
         static int from_python(PyObject* object)
         {
             GilLock lock;
-            if(Py_TYPE(object) == &PyLong_Type)
+            if(PyLong_Check(object))
             {
                 return int(PyLong_AsLongLong(object));
             }
@@ -1317,7 +1348,7 @@ namespace sweetPy{
         static const int& get_typed(char* fromBuffer, char* toBuffer)
         {
             PyObject* object = *(PyObject**)fromBuffer;
-            if(Py_TYPE(object) == &PyLong_Type)
+            if(PyLong_Check(object))
             {
                 new(toBuffer)int(PyLong_AsLong(object));
                 return *reinterpret_cast<int*>(toBuffer);
@@ -1672,15 +1703,7 @@ namespace sweetPy{
     {
         typedef typename Object<const char*>::FromPythonType FromPythonType;
         typedef typename Object<const char*>::Type Type;
-        static void* destructor(char* buffer)
-        {
-            if(*reinterpret_cast<std::uint32_t*>(buffer) != MAGIC_WORD)
-            {
-                char* _buffer = *reinterpret_cast<char**>(buffer);
-                delete [] _buffer;
-            }
-            return nullptr;
-        }
+        static void* destructor(char* buffer){ return nullptr; }
     };
     
     template<std::size_t I>
@@ -1688,15 +1711,7 @@ namespace sweetPy{
     {
         typedef typename Object<char const *&>::FromPythonType FromPythonType;
         typedef typename Object<char const *&>::Type Type;
-        static void* destructor(char* buffer)
-        {
-            if(*reinterpret_cast<std::uint32_t*>(buffer) != MAGIC_WORD)
-            {
-                char* _buffer = *reinterpret_cast<char**>(buffer);
-                delete [] _buffer;
-            }
-            return nullptr;
-        }
+        static void* destructor(char* buffer){ return nullptr; }
     };
 
     template<std::size_t I>
@@ -1723,6 +1738,30 @@ namespace sweetPy{
         }
     };
     
+    template<std::size_t I>
+    struct ObjectWrapper<const std::pmr::string&, I>
+    {
+        typedef typename Object<const std::pmr::string&>::FromPythonType FromPythonType;
+        typedef typename Object<const std::pmr::string&>::Type Type;
+        static void* destructor(char* buffer)
+        {
+            reinterpret_cast<Type*>(buffer)->~Type();
+            return nullptr;
+        }
+    };
+
+    template<std::size_t I, typename X>
+    struct ObjectWrapper<const std::pmr::vector<X>&, I>
+    {
+        typedef typename Object<const std::pmr::vector<X>&>::FromPythonType FromPythonType;
+        typedef typename Object<const std::pmr::vector<X>&>::Type Type;
+        static void* destructor(char* buffer)
+        {
+            reinterpret_cast<Type*>(buffer)->~Type();
+            return nullptr;
+        }
+    };
+
     template<std::size_t I, typename X>
     struct ObjectWrapper<const std::vector<X>&, I>
     {
@@ -1,22 +1,36 @@
 #pragma once
 
 #include <Python.h>
+#include <atomic>
 #include <functional>
 #include <iostream>
 #include <string>
 #include <memory>
+#include <cstddef>
 #include <iterator>
 #include <vector>
 #include <algorithm>
 #include <structmember.h>
+#include "../Core/FreeList.h"
 
 namespace sweetPy {
+    class TypesContainer;
     
     struct CPythonGCHead
     {
         PyGC_Head m_gc;
     };
 
+    //The kind of instances a type represents in respect to the native type it was registered for.
+    enum class TypeCategory
+    {
+        Foreign,
+        Value,
+        ConstValue,
+        Reference,
+        ConstReference
+    };
+
     //vptr is not allowed
     struct CPythonType : public CPythonGCHead, public PyHeapTypeObject
     {
@@ -26,12 +40,14 @@ namespace sweetPy {
         template<typename T> struct CPythonTypeHash{};
         template<typename FreeT>
         CPythonType(const std::string& name, const std::string& doc, std::size_t hash_code, const FreeT& freeType)
-                :CPythonGCHead{}, PyHeapTypeObject{}, m_name(name), m_doc(doc), m_hash_code(hash_code), m_freeType(freeType)
+                :CPythonGCHead{}, PyHeapTypeObject{}, m_name(name), m_doc(doc), m_hash_code(hash_code), m_freeType(freeType), m_slot(nullptr),
+                 m_container(nullptr), m_identity(0), m_category(TypeCategory::Foreign)
         {
             reset_gc_head();
         }
         ~CPythonType()
         {
+            unregister();
             if(ht_type.tp_members != nullptr)
             {
                 MembersDefs membersDefs(ht_type.tp_members);
@@ -41,13 +57,56 @@ namespace sweetPy {
                     delete[] memberDef.doc;
                 }
             }
+            if(ht_type.tp_getset != nullptr)
+            {
+                for(PyGetSetDef* getSetDef = ht_type.tp_getset; getSetDef->name != nullptr; getSetDef++)
+                {
+                    delete[] getSetDef->name;
+                    delete[] getSetDef->doc;
+                }
+            }
             delete[] ht_type.tp_members;
+            delete[] ht_type.tp_getset;
             delete[] ht_type.tp_methods;
         }
         void add_descriptor(DescriptorPtr&& descriptor)
         {
             m_descriptors.emplace_back(descriptor.release());
         }
+        //Instances are allocated through a per type free list retaining up to capacity released instances.
+        void enable_free_list(std::size_t capacity)
+        {
+            if(capacity == 0)
+                return;
+            m_freeList.set_capacity(capacity);
+            ht_type.tp_alloc = &alloc_instance;
+            ht_type.tp_free = &free_instance;
+        }
+        //Instances of types aligned beyond the python allocator's guarantee are allocated through an aligned allocator.
+        void set_alignment(std::size_t alignment)
+        {
+            m_freeList.set_alignment(alignment);
+            if(m_freeList.get_alignment() == 0)
+                return;
+            ht_type.tp_alloc = &alloc_instance;
+            ht_type.tp_free = &free_instance;
+        }
+        const FreeList& get_free_list() const {return m_freeList;}
+        //Binds the type slot referring to the type, the slot is reset upon the type's destruction.
+        void bind_slot(std::atomic<CPythonType*>* slot){ m_slot = slot; }
+        //Binds the registry, of the interpreter the type belongs to, the type is registered with.
+        void bind_container(TypesContainer* container){ m_container = container; }
+        const TypesContainer* get_container() const {return m_container;}
+        //Detaches the type from its registry and slot, as the registry is destroyed ahead of the type.
+        void unbind();
+        //identity is the tag of the native type, stripped of its const and reference wrappers.
+        void set_identity(std::size_t identity, TypeCategory category)
+        {
+            m_identity = identity;
+            m_category = category;
+        }
+        std::size_t get_identity() const {return m_identity;}
+        TypeCategory get_category() const {return m_category;}
         const std::string& get_name() const {return m_name;}
         const std::string& get_doc() const {return m_doc;}
         std::size_t get_hash_code() const {return m_hash_code;}
@@ -60,6 +119,14 @@ namespace sweetPy {
         {
             return static_cast<CPythonType*>(reinterpret_cast<CPythonGCHead*>(object) - 1);
         }
+        //nullptr is returned for non sweetPy types, sweetPy types are instances of meta classes carrying MetaCheckSum.
+        static CPythonType* find_type(PyTypeObject* type)
+        {
+            if(Py_SIZE(Py_TYPE(type)) != MetaCheckSum)
+                return nullptr;
+            return get_type(reinterpret_cast<PyObject*>(type));
+        }
+        static constexpr Py_ssize_t MetaCheckSum = 0xABCCBA;
         void clear_trace_ref()
         {
 #ifdef Py_TRACE_REF
@@ -102,6 +169,10 @@ namespace sweetPy {
         };
         
     private:
+        //Resets the type's registration, the type is no longer resolvable through TypesContainer.
+        void unregister();
+        static PyObject* alloc_instance(PyTypeObject* type, Py_ssize_t nitems);
+        static void free_instance(void* object);
         void reset_gc_head()
         {
             auto& gc = static_cast<CPythonGCHead&>(*this);
@@ -118,5 +189,10 @@ namespace sweetPy {
         typedef std::vector<DescriptorPtr> Descriptors;
         Descriptors m_descriptors; //No ownership of name and doc (functions take ownership on their meta data and not the descriptor). PyCFunctionObject won't take ownership on the descriptor, so the ownership is transfered to sweetPy CPythonType.
         Free m_freeType;
+        FreeList m_freeList;
+        std::atomic<CPythonType*>* m_slot;
+        TypesContainer* m_container;
+        std::size_t m_identity;
+        TypeCategory m_category;
     };
 }
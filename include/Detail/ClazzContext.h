@@ -3,39 +3,26 @@
 #include <unordered_map>
 #include <memory>
 #include "../Core/SPException.h"
-#include "MemberAccessor.h"
 #include "Function.h"
+#include "OverloadedFunction.h"
 
 namespace sweetPy{
+    //Populated while the module initializes and immutable afterwards, so read without locking.
     class ClazzContext
     {
     public:
         typedef int HashKey;
-        typedef int Offset;
         typedef std::shared_ptr<Function> FunctionPtr;
-        typedef std::shared_ptr<MemberAccessor> MemberAccessorPtr;
         typedef std::unordered_map<HashKey, FunctionPtr> MemberFunctions;
         
-        void add_member(Offset offset, MemberAccessorPtr&& memberAccessor)
-        {
-            if (m_memberAccessors.find(offset) != m_memberAccessors.end())
-                throw CPythonException(PyExc_KeyError, __CORE_SOURCE,
-                                       "offset already defined  - %d", offset);
-            m_memberAccessors.insert({offset, std::move(memberAccessor)});
-        }
-        MemberAccessor &get_accessor(Offset offset) const
-        {
-            auto it = m_memberAccessors.find(offset);
-            if (it == m_memberAccessors.end())
-                throw CPythonException(PyExc_LookupError, __CORE_SOURCE,
-                                       "Requested accessor couldn't be found, offset - %d", offset);
-            return *it->second;
-        }
+        //Functions bound under an already used key are merged into an overloaded function.
         void add_member_function(HashKey key, FunctionPtr&& memberFunction)
         {
-            if(m_memberFunctions.find(key) != m_memberFunctions.end())
-                throw CPythonException(PyExc_KeyError, __CORE_SOURCE, "member function key already in use");
-            m_memberFunctions.insert({key, std::move(memberFunction)});
+            auto it = m_memberFunctions.find(key);
+            if(it != m_memberFunctions.end())
+                OverloadedFunction::merge(it->second, std::move(memberFunction));
+            else
+                m_memberFunctions.insert({key, std::move(memberFunction)});
         }
         Function &get_member_function(HashKey key) const
         {
@@ -47,9 +34,11 @@ namespace sweetPy{
         }
         void add_member_static_function(HashKey key, FunctionPtr&& memberFunction)
         {
-            if(m_memberStaticFunctions.find(key) != m_memberStaticFunctions.end())
-                throw CPythonException(PyExc_KeyError, __CORE_SOURCE, "member function key already in use");
-            m_memberStaticFunctions.insert({key, std::move(memberFunction)});
+            auto it = m_memberStaticFunctions.find(key);
+            if(it != m_memberStaticFunctions.end())
+                OverloadedFunction::merge(it->second, std::move(memberFunction));
+            else
+                m_memberStaticFunctions.insert({key, std::move(memberFunction)});
         }
         bool is_member_functions_empty()
         {
@@ -63,8 +52,6 @@ namespace sweetPy{
         const MemberFunctions& get_member_static_functions() const { return m_memberStaticFunctions; }
     
     private:
-        typedef std::unordered_map<int, MemberAccessorPtr> MemberAccessors;
-        MemberAccessors m_memberAccessors; //Nothing is shared, but due to the fact vptr is not allowed we will use raii to keep the memory in check.
         MemberFunctions m_memberFunctions;
         MemberFunctions m_memberStaticFunctions;
         
@@ -9,7 +9,7 @@
 #include "CPythonType.h"
 #include "Object.h"
 #include "ClazzContext.h"
-#include "MemberAccessor.h"
+#include "MethodDescriptor.h"
 
 namespace sweetPy {
     
@@ -18,7 +18,6 @@ namespace sweetPy {
     {
     public:
         typedef ClazzPyType<T> Self;
-        typedef std::unique_ptr<MemberAccessor> MemeberAccessorPtr;
         typedef std::unique_ptr<ClazzContext> ClazzContextPtr;
         
         ClazzPyType(const std::string &name, const std::string &doc, Free freeType)
@@ -30,11 +29,12 @@ namespace sweetPy {
             ht_type.tp_name = m_name.c_str();
             ht_type.tp_basicsize = ClazzObject<T>::get_size();
             ht_type.tp_dealloc = &dealloc_object;
-            ht_type.tp_flags = Py_TPFLAGS_HEAPTYPE;
+            ht_type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HEAPTYPE;
             ht_type.tp_new = PyBaseObject_Type.tp_new;
             ht_type.tp_alloc = PyBaseObject_Type.tp_alloc;
-            ht_type.tp_setattro = &set_attribute;
-            ht_type.tp_getattro = &get_attribute;
+            ht_type.tp_setattro = PyObject_GenericSetAttr;
+            ht_type.tp_getattro = PyObject_GenericGetAttr;
+            set_alignment(alignof(ClazzObject<T>));
     
             auto docBuf = (char*)malloc(sizeof(char)*(m_doc.size() + 1));
             std::copy(m_doc.begin(), m_doc.end(), docBuf);
@@ -44,65 +44,25 @@ namespace sweetPy {
         ClazzPyType(const ClazzPyType&)=delete;
         ClazzPyType& operator=(const ClazzPyType&)=delete;
         ClazzContext& get_context(){ return *m_context; }
-        
-    private:
-        static void dealloc_object(PyObject *object)
-        {
-            reinterpret_cast<T*>(ClazzObject<T>::get_val_offset(object))->~T();
-            PyBaseObject_Type.tp_dealloc(object);
-        }
-        static int set_attribute(PyObject *object, PyObject *attrName, PyObject *value)
+        //Invoked once the type is ready, member functions are placed as descriptors within the type dictionary.
+        void init_methods()
         {
-            Self& type = *static_cast<Self*>(reinterpret_cast<PyHeapTypeObject*>(object->ob_type));
-            CPYTHON_VERIFY(attrName->ob_type == &PyUnicode_Type, "attrName must be py string type");
-            ObjectPtr bytesObject(PyUnicode_AsASCIIString(attrName), &Deleter::Owner);
-            CPYTHON_VERIFY_EXC(bytesObject.get() != nullptr);
-            char *name = PyBytes_AsString(bytesObject.get());
-            MembersDefs defs(type.ht_type.tp_members);
-            auto it = std::find_if(defs.begin(), defs.end(), [&name](typename MembersDefs::iterator::reference rhs) {
-                return strcmp(rhs.name, name) == 0;
-            });
-            if (it == defs.end())
-                throw CPythonException(PyExc_KeyError, __CORE_SOURCE, "Requested attribute - %s, was not found", name);
-            
-            MemberAccessor &accessor = type.get_context().get_accessor(it->offset);
-            accessor.set(object, value);
-            return 0;
-        }
-        
-        static PyObject* get_attribute(PyObject *object, PyObject *attrName)
-        {
-            Self& type = *static_cast<Self*>(reinterpret_cast<PyHeapTypeObject*>(object->ob_type));
-            CPYTHON_VERIFY(attrName->ob_type == &PyUnicode_Type, "attrName must be py unicode type");
-            ObjectPtr bytesObject(PyUnicode_AsASCIIString(attrName), &Deleter::Owner);
-            CPYTHON_VERIFY_EXC(bytesObject.get() != nullptr);
-            char *name = PyBytes_AsString(bytesObject.get());
-            MembersDefs defs(type.ht_type.tp_members);
-            auto it = std::find_if(defs.begin(), defs.end(), [&name](typename MembersDefs::iterator::reference rhs) {
-                return strcmp(rhs.name, name) == 0;
-            });
-            if (it == defs.end())
+            for (auto &methodPair : m_context->get_member_functions())
             {
-                ObjectPtr descriptor(PyDict_GetItem(type.ht_type.tp_dict, attrName), &Deleter::Borrow);
-                if(descriptor.get() != nullptr && descriptor->ob_type == &PyMethodDescr_Type)
-                    return get_method(descriptor, object);
-                else
-                    return  PyObject_GenericGetAttr(object, attrName);
+                Function& function = *methodPair.second;
+                ObjectPtr name(PyUnicode_InternFromString(function.get_name().c_str()), &Deleter::Owner);
+                ObjectPtr descriptor = MethodDescriptor::create(&ht_type, function);
+                CPYTHON_VERIFY(PyDict_SetItem(ht_type.tp_dict, name.get(), descriptor.get()) == 0,
+                               "Method descriptor insertion failed");
             }
-            
-            MemberAccessor &accessor = type.get_context().get_accessor(it->offset);
-            return accessor.get(object);
+            PyType_Modified(&ht_type);
         }
         
-        static PyObject* get_method(const ObjectPtr& descr, PyObject *obj)
+    private:
+        static void dealloc_object(PyObject *object)
         {
-            PyMethodDescrObject& descriptor = static_cast<PyMethodDescrObject&>(*(PyMethodDescrObject*)descr.get());
-            ObjectPtr self(PyTuple_New(2), &Deleter::Owner); //self = name and object, function will release the tuple
-            Py_XINCREF(obj); //tuple steals the reference
-            PyTuple_SetItem(self.get(), 0, obj);
-            Py_XINCREF(descriptor.d_common.d_name); //tuple steals the reference
-            PyTuple_SetItem(self.get(), 1, descriptor.d_common.d_name);
-            return PyCFunction_NewEx(descriptor.d_method, self.get(), NULL);
+            reinterpret_cast<T*>(ClazzObject<T>::get_val_offset(object))->~T();
+            PyBaseObject_Type.tp_dealloc(object);
         }
     
     private:
@@ -1,20 +1,29 @@
 #pragma once
 
-#include <initializer_list>
 #include <memory>
+#include <optional>
+#include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 #include <Python.h>
 #include "../Core/Lock.h"
+#include "../Core/ScratchArena.h"
+#include "../Core/ThreadPool.h"
 #include "../Core/Traits.h"
 #include "../Core/SPException.h"
 #include "../Core/Stack.h"
 #include "../Core/Assert.h"
+#include "../Core/Deleter.h"
+#include "../Types/ObjectPtr.h"
 #include "Function.h"
 #include "MetaClass.h"
 #include "TypesContainer.h"
 #include "CPythonObject.h"
 #include "ClazzPyType.h"
 #include "ModuleContext.h"
+#include "ArgumentsParser.h"
+#include "ArgumentMatcher.h"
 
 namespace sweetPy {
 
@@ -32,159 +41,368 @@ namespace sweetPy {
     }
 
     template<typename Return, typename... Args>
-    class MemberFunction: public Function
+    struct NativeInvoker
     {
-        virtual ~MemberFunction() = default;
-    };
+        typedef ArgumentsParser<Args...> Parser;
 
-    template<typename ClassType, typename MemberFunctionType, typename Return, typename... Args>
-    class MemberFunction<ClassType, Return(MemberFunctionType::*)(Args...)> : public Function{
-    public:
-        typedef Return(MemberFunctionType::*MemberFunctionPtr)(Args...);
-        typedef MemberFunction<ClassType, Return(MemberFunctionType::*)(Args...)> Self;
-        typedef enable_if_t<std::is_base_of<MemberFunctionType, ClassType>::value> VirtualSupport;
+        template<typename Callable, std::size_t... I>
+        static Return invoke(bool releaseGil, Callable&& callable, char* pythonArgsBuffer, char* nativeArgsBuffer, std::index_sequence<I...>)
+        {
+            if(releaseGil)
+            {
+                //Arguments are converted while the GIL is still held, only the native body runs without it.
+                std::tuple<Args...> arguments{Object<Args>::get_typed(pythonArgsBuffer + Parser::PythonOffsets[I],
+                                                                      nativeArgsBuffer + Parser::NativeOffsets[I])...};
+                GilRelease gilRelease;
+                return callable(std::forward<Args>(std::get<I>(arguments))...);
+            }
+            return callable(std::forward<Args>(Object<Args>::get_typed(pythonArgsBuffer + Parser::PythonOffsets[I],
+                                                                       nativeArgsBuffer + Parser::NativeOffsets[I]))...);
+        }
+    };
 
-        MemberFunction(const std::string& name, const std::string& doc, const MemberFunctionPtr &memberMethod)
-                : Function(name, doc), m_memberMethod(memberMethod) {}
+    //Storage of a batch's native results, which are converted into python only once the batch completes.
+    template<typename Return, typename = void>
+    struct BatchResults
+    {
+        explicit BatchResults(std::size_t size) : m_results(size) {}
+        template<typename Callable>
+        void invoke(std::size_t index, Callable&& callable)
+        {
+            m_results[index].emplace(callable());
+        }
+        PyObject* to_python(std::size_t index)
+        {
+            return convert_return<Return>(*m_results[index]);
+        }
 
-        virtual ~MemberFunction(){}
-        MemberFunction(MemberFunction &) = delete;
-        MemberFunction &operator=(MemberFunction &) = delete;
+    private:
+        std::vector<std::optional<Return>> m_results;
+    };
 
-        MemberFunction(MemberFunction &&obj)
-                : Function(std::move(static_cast<Function&>(obj))), m_memberMethod(nullptr)
+    template<typename Return>
+    struct BatchResults<Return, enable_if_t<std::is_reference<Return>::value>>
+    {
+        explicit BatchResults(std::size_t size) : m_results(size, nullptr) {}
+        template<typename Callable>
+        void invoke(std::size_t index, Callable&& callable)
         {
-            std::swap(m_memberMethod, obj.m_memberMethod);
+            Return result = callable();
+            m_results[index] = &result;
         }
-
-        MemberFunction &operator=(MemberFunction &&obj)
+        PyObject* to_python(std::size_t index)
         {
-            Function::operator=(std::move(static_cast<Function&>(obj)));
-            std::swap(m_memberMethod, obj.m_memberMethod);
+            Return result = static_cast<Return>(*m_results[index]);
+            return convert_return<Return>(result);
         }
 
-        template<bool Enable = true, std::size_t... I>
-        static enable_if_t<!std::is_same<Return, void>::value && Enable, PyObject*>
-        wrapper_impl(PyObject *self, PyObject *args, std::index_sequence<I...>)
+    private:
+        std::vector<typename std::remove_reference<Return>::type*> m_results;
+    };
+
+    template<typename Return>
+    struct BatchResults<Return, enable_if_t<std::is_same<Return, void>::value>>
+    {
+        explicit BatchResults(std::size_t) {}
+        template<typename Callable>
+        void invoke(std::size_t, Callable&& callable)
         {
-            std::initializer_list<const char *> formatList = {Object<Args>::Format...};
-            std::string format;
-            for (auto &subFormat : formatList)
-                format += subFormat;
+            callable();
+        }
+        PyObject* to_python(std::size_t)
+        {
+            Py_XINCREF(Py_None);
+            return Py_None;
+        }
+    };
 
-            char pythonArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::FromPythonType...>::value)];
-            char nativeArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::Type...>::value)];
-            {
-                CPYTHON_VERIFY(PyArg_ParseTuple(args, format.c_str(), (pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,
-                        ObjectWrapper<Args, I>...>::value)...), "Invalid argument was provided");
-            }
+    class List;
+    class Tuple;
+    class Dictionary;
+    class DateTime;
+    class TimeDelta;
 
-            ObjectPtr _self(PyTuple_GET_ITEM(self, 0), &Deleter::Borrow);
-            ObjectPtr unicodeName(PyTuple_GET_ITEM(self, 1), &Deleter::Borrow);
-            std::string name = Object<std::string>::from_python(unicodeName.get());
-    
-            ClassType* _this;
-            using RefObject = ReferenceObject<ClassType>;
-            auto& heapType = *reinterpret_cast<PyHeapTypeObject*>(_self->ob_type);
-            ClazzContext* context;
-            if(ClazzObject<RefObject>::is_ref(_self.get()))
+    //Python objects and the wrappers over them, which may not be touched by native calls running without the GIL.
+    template<typename T, typename Type = std::remove_cv_t<std::remove_reference_t<T>>>
+    struct is_python_typed : std::integral_constant<bool,
+            std::is_same<std::remove_cv_t<std::remove_pointer_t<Type>>, PyObject>::value ||
+            std::is_same<Type, ObjectPtr>::value || std::is_same<Type, List>::value || std::is_same<Type, Tuple>::value ||
+            std::is_same<Type, Dictionary>::value || std::is_same<Type, DateTime>::value || std::is_same<Type, TimeDelta>::value> {};
+
+    //Whether a function takes or returns python objects, such functions may not be bound to run without the GIL.
+    template<typename X>
+    struct is_python_signature : std::false_type {};
+
+    template<typename Return, typename... Args>
+    struct is_python_signature<Return(*)(Args...)> : std::integral_constant<bool,
+            is_python_typed<Return>::value || (is_python_typed<Args>::value || ...)> {};
+
+    template<typename ClassType, typename Return, typename... Args>
+    struct is_python_signature<Return(ClassType::*)(Args...)> : is_python_signature<Return(*)(Args...)> {};
+
+    template<typename ClassType, typename Return, typename... Args>
+    struct is_python_signature<Return(ClassType::*)(Args...) const> : is_python_signature<Return(*)(Args...)> {};
+
+    template<typename Impl, typename Return, typename... Args>
+    struct Dispatcher
+    {
+        typedef ArgumentsParser<Args...> Parser;
+        typedef std::make_index_sequence<sizeof...(Args)> Indices;
+
+        static PyObject* call(Impl& function, PyObject* instance, PyObject* const* args, Py_ssize_t nargs)
+        {
+            try
             {
-                auto& refObject = ClazzObject<RefObject>::get_val(_self.get());
-                _this = &refObject.get_ref();
-        
-                context = &static_cast<ClazzPyType<RefObject>&>(heapType).get_context();
+                char pythonArgsBuffer[Parser::PythonArgsSize];
+                Parser::parse(args, nargs, pythonArgsBuffer, Indices{});
+                return wrapper_impl(function, instance, pythonArgsBuffer, Indices{});
             }
-            else
+            catch(const CPythonException& exc)
             {
-                _this = &ClazzObject<ClassType>::get_val(_self.get());
-                context = &static_cast<ClazzPyType<ClassType>&>(heapType).get_context();
+                exc.raise();
+                return NULL;
             }
-            
-            Function& function = context->get_member_function(std::hash<std::string>()(name));
-            Self& m_pyFunc = static_cast<Self&>(function);
-            
-            Return result = (_this->*m_pyFunc.m_memberMethod)(std::forward<Args>(Object<Args>::get_typed(
-                    pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value,
-                    nativeArgsBuffer + ObjectOffset<ToNative, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value))...);
-
-            invoker(ObjectWrapper<Args, I>::destructor(nativeArgsBuffer +
-                    ObjectOffset<ToNative, ObjectWrapper<Args, I>,
-                            ObjectWrapper<Args, I>...>::value)...);
+        }
+
+        template<bool Enable = true, std::size_t... I>
+        static enable_if_t<!std::is_same<Return, void>::value && Enable, PyObject*>
+        wrapper_impl(Impl& function, PyObject* instance, char* pythonArgsBuffer, std::index_sequence<I...>)
+        {
+            ScratchArena::Scope scratchScope;
+            char nativeArgsBuffer[Parser::NativeArgsSize];
+
+            Return result = NativeInvoker<Return, Args...>::invoke(function.is_releasing_gil(),
+                    [&](Args&&... args) -> Return { return Impl::invoke(function, instance, std::forward<Args>(args)...); },
+                    pythonArgsBuffer, nativeArgsBuffer, std::index_sequence<I...>{});
+
+            Parser::destroy(nativeArgsBuffer, std::index_sequence<I...>{});
 
             return convert_return<Return>(result);
         }
 
         template<bool Enable = true, std::size_t... I>
         static enable_if_t<std::is_same<Return, void>::value && Enable, PyObject*>
-        wrapper_impl(PyObject *self, PyObject *args, std::index_sequence<I...>)
+        wrapper_impl(Impl& function, PyObject* instance, char* pythonArgsBuffer, std::index_sequence<I...>)
         {
-            std::initializer_list<const char *> formatList = {Object<Args>::Format...};
-            std::string format;
-            for (auto &subFormat : formatList)
-                format += subFormat;
+            ScratchArena::Scope scratchScope;
+            char nativeArgsBuffer[Parser::NativeArgsSize];
+
+            NativeInvoker<Return, Args...>::invoke(function.is_releasing_gil(),
+                    [&](Args&&... args) -> Return { return Impl::invoke(function, instance, std::forward<Args>(args)...); },
+                    pythonArgsBuffer, nativeArgsBuffer, std::index_sequence<I...>{});
 
-            char pythonArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::FromPythonType...>::value)];
-            char nativeArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::Type...>::value)];
+            Parser::destroy(nativeArgsBuffer, std::index_sequence<I...>{});
+
+            Py_XINCREF(Py_None);
+            return Py_None;
+        }
+
+        //A batch element holds the function's arguments, elements are unpacked for functions of several arguments.
+        static void get_element_arguments(PyObject* const& element, PyObject* const*& args, Py_ssize_t& nargs)
+        {
+            if(Parser::ArgsCount == 1)
             {
-                CPYTHON_VERIFY(PyArg_ParseTuple(args, format.c_str(), (pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,
-                        ObjectWrapper<Args, I>...>::value)...), "Invalid argument was provided");
+                args = &element;
+                nargs = 1;
+                return;
             }
+            if(PyTuple_Check(element) == false)
+                throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "map expects tuple elements for a function of %d arguments",
+                                       (int)Parser::ArgsCount);
+            args = &PyTuple_GET_ITEM(element, 0);
+            nargs = PyTuple_GET_SIZE(element);
+        }
 
-            ObjectPtr _self(PyTuple_GET_ITEM(self, 0), &Deleter::Borrow);
-            ObjectPtr unicodeName(PyTuple_GET_ITEM(self, 1), &Deleter::Borrow);
-            std::string name = Object<std::string>::from_python(unicodeName.get());
-
-            ClassType* _this;
-            using RefObject = ReferenceObject<ClassType>;
-            auto& heapType = *reinterpret_cast<PyHeapTypeObject*>(_self->ob_type);
-            ClazzContext* context;
-            if(ClazzObject<RefObject>::is_ref(_self.get()))
+        //Applies the function over each element of iterable.
+        static PyObject* map(Impl& function, PyObject* instance, PyObject* iterable)
+        {
+            try
             {
-                auto& refObject = ClazzObject<RefObject>::get_val(_self.get());
-                _this = &refObject.get_ref();
-                
-                context = &static_cast<ClazzPyType<RefObject >&>(heapType).get_context();
+                ObjectPtr sequence(PySequence_Fast(iterable, "map expects an iterable"), &Deleter::Owner);
+                if(sequence.get() == nullptr)
+                    return NULL;
+                Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence.get());
+                PyObject** items = PySequence_Fast_ITEMS(sequence.get());
+                ObjectPtr results(PyList_New(size), &Deleter::Owner);
+                CPYTHON_VERIFY(results.get() != nullptr, "Results list allocation failed");
+
+                char pythonArgsBuffer[Parser::PythonArgsSize];
+                for(Py_ssize_t index = 0; index < size; index++)
+                {
+                    PyObject* const* args = nullptr;
+                    Py_ssize_t nargs = 0;
+                    get_element_arguments(items[index], args, nargs);
+                    Parser::parse(args, nargs, pythonArgsBuffer, Indices{});
+                    PyObject* result = wrapper_impl(function, instance, pythonArgsBuffer, Indices{});
+                    if(result == nullptr)
+                        return NULL;
+                    PyList_SET_ITEM(results.get(), index, result);
+                }
+                return results.release();
             }
-            else
+            catch(const CPythonException& exc)
             {
-                _this = &ClazzObject<ClassType>::get_val(_self.get());
-                context = &static_cast<ClazzPyType<ClassType>&>(heapType).get_context();
+                exc.raise();
+                return NULL;
             }
-    
-            Function& function = context->get_member_function(std::hash<std::string>()(name));
-            Self& m_pyFunc = static_cast<Self&>(function);
-
-            (_this->*m_pyFunc.m_memberMethod)(std::forward<Args>(Object<Args>::get_typed(
-                    pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value,
-                    nativeArgsBuffer + ObjectOffset<ToNative, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value))...);
-
-            invoker(ObjectWrapper<Args, I>::destructor(nativeArgsBuffer +
-                ObjectOffset<ToNative, ObjectWrapper<Args, I>, ObjectWrapper<Args, I>...>::value)...);
-            Py_XINCREF(Py_None);
-            return Py_None;
         }
 
-        static PyObject* wrapper(PyObject *self, PyObject *args) {
+        /*
+         * Arguments conversion and results boxing take place under the GIL, the native calls
+         * are distributed over sweetPy's thread pool while the GIL is released.
+         */
+        static PyObject* parallel_map(Impl& function, PyObject* instance, PyObject* iterable, std::size_t concurrency)
+        {
             try
             {
-                return wrapper_impl(self, args, std::make_index_sequence<sizeof...(Args)>{});
+                if(is_python_typed<Return>::value || (is_python_typed<Args>::value || ...))
+                    throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "parallel_map requires a native signature, %s takes or returns python objects",
+                                           function.get_name().c_str());
+                ObjectPtr sequence(PySequence_Fast(iterable, "parallel_map expects an iterable"), &Deleter::Owner);
+                if(sequence.get() == nullptr)
+                    return NULL;
+                std::size_t size = PySequence_Fast_GET_SIZE(sequence.get());
+                PyObject** items = PySequence_Fast_ITEMS(sequence.get());
+
+                //The batch's arguments are shared with the pool's workers.
+                ScratchArena::Suspension scratchSuspension;
+                BatchArguments arguments(size);
+                for(std::size_t index = 0; index < size; index++)
+                {
+                    PyObject* const* args = nullptr;
+                    Py_ssize_t nargs = 0;
+                    get_element_arguments(items[index], args, nargs);
+                    arguments.convert(index, args, nargs, Indices{});
+                }
+
+                BatchResults<Return> results(size);
+                {
+                    GilRelease gilRelease;
+                    ThreadPool& pool = ThreadPool::instance();
+                    pool.parallel_for(size, concurrency == 0 ? pool.get_workers_count() + 1 : concurrency, [&](std::size_t index){
+                        results.invoke(index, [&]() -> Return { return arguments.invoke(function, instance, index, Indices{}); });
+                    });
+                }
+
+                ObjectPtr list(PyList_New(size), &Deleter::Owner);
+                CPYTHON_VERIFY(list.get() != nullptr, "Results list allocation failed");
+                for(std::size_t index = 0; index < size; index++)
+                    PyList_SET_ITEM(list.get(), index, results.to_python(index));
+                return list.release();
             }
             catch(const CPythonException& exc)
             {
                 exc.raise();
                 return NULL;
             }
+        }
+
+    private:
+        //Converted arguments of every batch element, each element owns its own python and native buffers.
+        class BatchArguments
+        {
+        public:
+            explicit BatchArguments(std::size_t size)
+                : m_pythonArgs(size * Parser::PythonArgsSize), m_nativeArgs(size * Parser::NativeArgsSize)
+            {
+                m_arguments.reserve(size);
+            }
+            ~BatchArguments()
+            {
+                std::size_t converted = m_arguments.size();
+                m_arguments.clear();
+                for(std::size_t index = 0; index < converted; index++)
+                    Parser::destroy(&m_nativeArgs[index * Parser::NativeArgsSize], Indices{});
+            }
+            template<std::size_t... I>
+            void convert(std::size_t index, PyObject* const* args, Py_ssize_t nargs, std::index_sequence<I...>)
+            {
+                char* pythonArgsBuffer = &m_pythonArgs[index * Parser::PythonArgsSize];
+                char* nativeArgsBuffer = &m_nativeArgs[index * Parser::NativeArgsSize];
+                Parser::parse(args, nargs, pythonArgsBuffer, std::index_sequence<I...>{});
+                m_arguments.emplace_back(Object<Args>::get_typed(pythonArgsBuffer + Parser::PythonOffsets[I],
+                                                                 nativeArgsBuffer + Parser::NativeOffsets[I])...);
+            }
+            template<std::size_t... I>
+            Return invoke(Impl& function, PyObject* instance, std::size_t index, std::index_sequence<I...>)
+            {
+                return Impl::invoke(function, instance, std::forward<Args>(std::get<I>(m_arguments[index]))...);
+            }
+
+        private:
+            std::vector<char> m_pythonArgs;
+            std::vector<char> m_nativeArgs;
+            std::vector<std::tuple<Args...>> m_arguments;
+        };
+    };
+
+    template<typename Return, typename... Args>
+    class MemberFunction: public Function
+    {
+        virtual ~MemberFunction() = default;
+    };
+
+    template<typename ClassType, typename MemberFunctionType, typename Return, typename... Args>
+    class MemberFunction<ClassType, Return(MemberFunctionType::*)(Args...)> : public Function{
+    public:
+        typedef Return(MemberFunctionType::*MemberFunctionPtr)(Args...);
+        typedef MemberFunction<ClassType, Return(MemberFunctionType::*)(Args...)> Self;
+        typedef enable_if_t<std::is_base_of<MemberFunctionType, ClassType>::value> VirtualSupport;
+
+        MemberFunction(const std::string& name, const std::string& doc, const MemberFunctionPtr &memberMethod)
+                : Function(name, doc), m_memberMethod(memberMethod) {}
+
+        virtual ~MemberFunction(){}
+        MemberFunction(MemberFunction &) = delete;
+        MemberFunction &operator=(MemberFunction &) = delete;
+
+        MemberFunction(MemberFunction &&obj)
+                : Function(std::move(static_cast<Function&>(obj))), m_memberMethod(nullptr)
+        {
+            std::swap(m_memberMethod, obj.m_memberMethod);
+        }
+
+        MemberFunction &operator=(MemberFunction &&obj)
+        {
+            Function::operator=(std::move(static_cast<Function&>(obj)));
+            std::swap(m_memberMethod, obj.m_memberMethod);
+        }
 
+        static ClassType* get_this(PyObject* object)
+        {
+            CPYTHON_VERIFY(object != nullptr, "Member function invocation requires an instance");
+            using RefObject = ReferenceObject<ClassType>;
+            if(ClazzObject<RefObject>::is_ref(object))
+                return &ClazzObject<RefObject>::get_val(object).get_ref();
+            return &ClazzObject<ClassType>::get_val(object);
+        }
+
+        static Return invoke(Self& function, PyObject* instance, Args&&... args)
+        {
+            return (get_this(instance)->*function.m_memberMethod)(std::forward<Args>(args)...);
+        }
+
+        PyObject* call(PyObject* instance, PyObject* const* args, Py_ssize_t nargs) override
+        {
+            return Dispatcher<Self, Return, Args...>::call(*this, instance, args, nargs);
         }
 
-        MethodDefPtr to_python() const override
+        PyObject* map(PyObject* instance, PyObject* iterable) override
         {
-            return MethodDefPtr(new PyMethodDef{
-                    m_name.c_str(),
-                    &wrapper,
-                    METH_VARARGS,
-                    m_doc.c_str()
-            });
+            return Dispatcher<Self, Return, Args...>::map(*this, instance, iterable);
+        }
+
+        //The workers would share a single instance, only const methods are invoked concurrently.
+        PyObject* parallel_map(PyObject* instance, PyObject* iterable, std::size_t concurrency) override
+        {
+            CPythonException(PyExc_TypeError, __CORE_SOURCE, "parallel_map requires a const member function, %s mutates its instance",
+                             get_name().c_str()).raise();
+            return NULL;
+        }
+
+        bool accepts(PyObject* const* args, Py_ssize_t nargs) const override
+        {
+            return ArgumentsMatcher<Args...>::match(args, nargs);
         }
         
     private:
@@ -217,128 +435,38 @@ namespace sweetPy {
             std::swap(m_memberMethod, obj.m_memberMethod);
         }
 
-        template<bool Enable = true, std::size_t... I>
-        static enable_if_t<!std::is_same<Return, void>::value && Enable, PyObject*>
-        wrapper_impl(PyObject *self, PyObject *args, std::index_sequence<I...>)
+        static ClassType* get_this(PyObject* object)
         {
-            std::initializer_list<const char *> formatList = {Object<Args>::Format...};
-            std::string format;
-            for (auto &subFormat : formatList)
-                format += subFormat;
-
-            char pythonArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::FromPythonType...>::value)];
-            char nativeArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::Type...>::value)];
-            {
-                CPYTHON_VERIFY(PyArg_ParseTuple(args, format.c_str(), (pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,
-                        ObjectWrapper<Args, I>...>::value)...), "Invalid argument was provided");
-            }
-
-            ObjectPtr _self(PyTuple_GET_ITEM(self, 0), &Deleter::Borrow);
-            ObjectPtr unicodeName(PyTuple_GET_ITEM(self, 1), &Deleter::Borrow);
-            std::string name = Object<std::string>::from_python(unicodeName.get());
-    
-            ClassType* _this;
+            CPYTHON_VERIFY(object != nullptr, "Member function invocation requires an instance");
             using RefObject = ReferenceObject<ClassType>;
-            auto& heapType = *reinterpret_cast<PyHeapTypeObject*>(_self->ob_type);
-            ClazzContext* context;
-            if(ClazzObject<RefObject>::is_ref(_self.get()))
-            {
-                auto& refObject = ClazzObject<RefObject>::get_val(_self.get());
-                _this = &refObject.get_ref();
-        
-                context = &static_cast<ClazzPyType<RefObject >&>(heapType).get_context();
-            }
-            else
-            {
-                _this = &ClazzObject<ClassType>::get_val(_self.get());
-                context = &static_cast<ClazzPyType<ClassType>&>(heapType).get_context();
-            }
-    
-            Function& function = context->get_member_function(std::hash<std::string>()(name));
-            Self& m_pyFunc = static_cast<Self&>(function);
-            
-            Return result = (_this->*m_pyFunc.m_memberMethod)(std::forward<Args>(Object<Args>::get_typed(
-                    pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value,
-                    nativeArgsBuffer + ObjectOffset<ToNative, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value))...);
-
-            invoker(ObjectWrapper<Args, I>::destructor(nativeArgsBuffer +
-                        ObjectOffset<ToNative, ObjectWrapper<Args, I>,
-                            ObjectWrapper<Args, I>...>::value)...);
-            return convert_return<Return>(result);
+            if(ClazzObject<RefObject>::is_ref(object))
+                return &ClazzObject<RefObject>::get_val(object).get_ref();
+            return &ClazzObject<ClassType>::get_val(object);
         }
 
-        template<bool Enable = true, std::size_t... I>
-        static enable_if_t<std::is_same<Return, void>::value && Enable, PyObject*>
-        wrapper_impl(PyObject *self, PyObject *args, std::index_sequence<I...>)
+        static Return invoke(Self& function, PyObject* instance, Args&&... args)
         {
-            std::initializer_list<const char *> formatList = {Object<Args>::Format...};
-            std::string format;
-            for (auto &subFormat : formatList)
-                format += subFormat;
+            return (get_this(instance)->*function.m_memberMethod)(std::forward<Args>(args)...);
+        }
 
-            char pythonArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::FromPythonType...>::value)];
-            char nativeArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::Type...>::value)];
-            {
-                CPYTHON_VERIFY(PyArg_ParseTuple(args, format.c_str(), (pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,
-                        ObjectWrapper<Args, I>...>::value)...), "Invalid argument was provided");
-            }
+        PyObject* call(PyObject* instance, PyObject* const* args, Py_ssize_t nargs) override
+        {
+            return Dispatcher<Self, Return, Args...>::call(*this, instance, args, nargs);
+        }
 
-            ObjectPtr _self(PyTuple_GET_ITEM(self, 0), &Deleter::Borrow);
-            ObjectPtr unicodeName(PyTuple_GET_ITEM(self, 1), &Deleter::Borrow);
-            std::string name = Object<std::string>::from_python(unicodeName.get());
-    
-            ClassType* _this;
-            using RefObject = ReferenceObject<ClassType>;
-            auto& heapType = *reinterpret_cast<PyHeapTypeObject*>(_self->ob_type);
-            ClazzContext* context;
-            if(ClazzObject<RefObject>::is_ref(_self.get()))
-            {
-                auto& refObject = ClazzObject<RefObject>::get_val(_self.get());
-                _this = &refObject.get_ref();
-        
-                context = &static_cast<ClazzPyType<RefObject >&>(heapType).get_context();
-            }
-            else
-            {
-                _this = &ClazzObject<ClassType>::get_val(_self.get());
-                context = &static_cast<ClazzPyType<ClassType>&>(heapType).get_context();
-            }
-    
-            Function& function = context->get_member_function(std::hash<std::string>()(name));
-            Self& m_pyFunc = static_cast<Self&>(function);
-            
-            (_this->*m_pyFunc.m_memberMethod)(std::forward<Args>(Object<Args>::get_typed(
-                    pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value,
-                    nativeArgsBuffer + ObjectOffset<ToNative, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value))...);
-
-            invoker(ObjectWrapper<Args, I>::destructor(nativeArgsBuffer +
-                ObjectOffset<ToNative, ObjectWrapper<Args, I>,
-                        ObjectWrapper<Args, I>...>::value)...);
-            
-            Py_XINCREF(Py_None);
-            return Py_None;
+        PyObject* map(PyObject* instance, PyObject* iterable) override
+        {
+            return Dispatcher<Self, Return, Args...>::map(*this, instance, iterable);
         }
 
-        static PyObject* wrapper(PyObject *self, PyObject *args) {
-            try
-            {
-                return wrapper_impl(self, args, std::make_index_sequence<sizeof...(Args)>{});
-            }
-            catch(const CPythonException& exc)
-            {
-                exc.raise();
-                return NULL;
-            }
+        PyObject* parallel_map(PyObject* instance, PyObject* iterable, std::size_t concurrency) override
+        {
+            return Dispatcher<Self, Return, Args...>::parallel_map(*this, instance, iterable, concurrency);
         }
 
-        MethodDefPtr to_python() const override
+        bool accepts(PyObject* const* args, Py_ssize_t nargs) const override
         {
-            return MethodDefPtr(new PyMethodDef{
-                    m_name.c_str(),
-                    &wrapper,
-                    METH_VARARGS,
-                    m_doc.c_str()
-            });
+            return ArgumentsMatcher<Args...>::match(args, nargs);
         }
 
     private:
@@ -377,100 +505,29 @@ namespace sweetPy {
             std::swap(m_staticMethod, obj.m_staticMethod);
         }
 
-        template<bool Enable = true, std::size_t... I>
-        static enable_if_t<!std::is_same<Return, void>::value && Enable, PyObject*>
-        wrapper_impl(PyObject *self, PyObject *args, std::index_sequence<I...>)
+        static Return invoke(Self& function, PyObject* instance, Args&&... args)
         {
-            std::initializer_list<const char *> formatList = {Object<Args>::Format...};
-            std::string format;
-            for (auto &subFormat : formatList)
-                format += subFormat;
-
-            char pythonArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::FromPythonType...>::value)];
-            char nativeArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::Type...>::value)];
-            {
-                CPYTHON_VERIFY(PyArg_ParseTuple(args, format.c_str(), (pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,
-                        ObjectWrapper<Args, I>...>::value)...), "Invalid argument was provided");
-            }
-    
-            ObjectPtr capsule(PyTuple_GET_ITEM(self, 0), &Deleter::Borrow);
-            MetaClass& meta = *reinterpret_cast<MetaClass*>(PyCapsule_GetPointer(capsule.get(), nullptr));
-            ObjectPtr hash_code(PyTuple_GET_ITEM(self, 1), &Deleter::Borrow);
-            unsigned long typed_hash_code = PyLong_AsUnsignedLong(hash_code.get());
-            
-            ClazzContext& context = meta.get_context();
-            Function& function = context.get_member_function(typed_hash_code);
-            Self& m_pyFunc = static_cast<Self&>(function);
-
-            Return result = (*m_pyFunc.m_staticMethod)(std::forward<Args>(Object<Args>::get_typed(
-                    pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value,
-                    nativeArgsBuffer + ObjectOffset<ToNative, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value))...);
-
-            invoker(ObjectWrapper<Args, I>::destructor(nativeArgsBuffer +
-                        ObjectOffset<ToNative, ObjectWrapper<Args, I>,
-                            ObjectWrapper<Args, I>...>::value)...);
-            
-            return convert_return<Return>(result);
+            return (*function.m_staticMethod)(std::forward<Args>(args)...);
         }
 
-        template<bool Enable = true, std::size_t... I>
-        static enable_if_t<std::is_same<Return, void>::value && Enable, PyObject*>
-        wrapper_impl(PyObject *self, PyObject *args, std::index_sequence<I...>)
+        PyObject* call(PyObject* instance, PyObject* const* args, Py_ssize_t nargs) override
         {
-            std::initializer_list<const char *> formatList = {Object<Args>::Format...};
-            std::string format;
-            for (auto &subFormat : formatList)
-                format += subFormat;
+            return Dispatcher<Self, Return, Args...>::call(*this, instance, args, nargs);
+        }
 
-            char pythonArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::FromPythonType...>::value)];
-            char nativeArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::Type...>::value)];
-            {
-                CPYTHON_VERIFY(PyArg_ParseTuple(args, format.c_str(), (pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,
-                        ObjectWrapper<Args, I>...>::value)...), "Invalid argument was provided");
-            }
-    
-            ObjectPtr capsule(PyTuple_GET_ITEM(self, 0), &Deleter::Borrow);
-            MetaClass& meta = *reinterpret_cast<MetaClass*>(PyCapsule_GetPointer(capsule.get(), nullptr));
-            ObjectPtr hash_code(PyTuple_GET_ITEM(self, 1), &Deleter::Borrow);
-            unsigned long typed_hash_code = PyLong_AsUnsignedLong(hash_code.get());
-    
-            ClazzContext& context = meta.get_context();
-            Function& function = context.get_member_function(typed_hash_code);
-            Self& typedFunc = static_cast<Self&>(function);
-            
-            (*typedFunc.m_staticMethod)(std::forward<Args>(Object<Args>::get_typed(
-                    pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value,
-                    nativeArgsBuffer + ObjectOffset<ToNative, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value))...);
-
-            invoker(ObjectWrapper<Args, I>::destructor(nativeArgsBuffer +
-                ObjectOffset<ToNative, ObjectWrapper<Args, I>,
-                    ObjectWrapper<Args, I>...>::value)...);
-            
-            Py_XINCREF(Py_None);
-            return Py_None;
+        PyObject* map(PyObject* instance, PyObject* iterable) override
+        {
+            return Dispatcher<Self, Return, Args...>::map(*this, instance, iterable);
         }
 
-        static PyObject* wrapper(PyObject *self, PyObject *args)
+        PyObject* parallel_map(PyObject* instance, PyObject* iterable, std::size_t concurrency) override
         {
-            try
-            {
-                return wrapper_impl(self, args, std::make_index_sequence<sizeof...(Args)>{});
-            }
-            catch(const CPythonException& exc)
-            {
-                exc.raise();
-                return NULL;
-            }
+            return Dispatcher<Self, Return, Args...>::parallel_map(*this, instance, iterable, concurrency);
         }
 
-        MethodDefPtr to_python() const override
+        bool accepts(PyObject* const* args, Py_ssize_t nargs) const override
         {
-            return MethodDefPtr(new PyMethodDef{
-                    m_name.c_str(),
-                    &wrapper,
-                    METH_VARARGS,
-                    m_doc.c_str()
-            });
+            return ArgumentsMatcher<Args...>::match(args, nargs);
         }
 
     private:
@@ -510,102 +567,29 @@ namespace sweetPy {
             std::swap(m_function, obj.m_function);
         }
 
-        template<bool Enable = true, std::size_t... I>
-        static enable_if_t<!std::is_same<Return, void>::value && Enable, PyObject*>
-        wrapper_impl(PyObject *self, PyObject *args, std::index_sequence<I...>)
+        static Return invoke(Self& function, PyObject* instance, Args&&... args)
         {
-            std::initializer_list<const char *> formatList = {Object<Args>::Format...};
-            std::string format;
-            for (auto &subFormat : formatList)
-                format += subFormat;
-
-            char pythonArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::FromPythonType...>::value)];
-            char nativeArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::Type...>::value)];
-            {
-                CPYTHON_VERIFY(PyArg_ParseTuple(args, format.c_str(), (pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,
-                        ObjectWrapper<Args, I>...>::value)...), "Invalid argument was provided");
-            }
-    
-            ObjectPtr contextCapsule(PyTuple_GET_ITEM(self, 0), &Deleter::Borrow);
-            ObjectPtr hash_code(PyTuple_GET_ITEM(self, 1), &Deleter::Borrow);
-            unsigned long typed_hash_code = PyLong_AsUnsignedLong(hash_code.get());
-    
-            auto& context = *reinterpret_cast<ModuleContext*>(PyCapsule_GetPointer(contextCapsule.get(), nullptr));
-            context.get_function(typed_hash_code);
-    
-            Function& function = context.get_function(typed_hash_code);
-            Self& typedFunc = static_cast<Self&>(function);
-            
-            Return result = (*typedFunc.m_function)(std::forward<Args>(Object<Args>::get_typed(
-                    pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value,
-                    nativeArgsBuffer + ObjectOffset<ToNative, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value))...);
-
-            invoker(ObjectWrapper<Args, I>::destructor(nativeArgsBuffer +
-                ObjectOffset<ToNative, ObjectWrapper<Args, I>,
-                    ObjectWrapper<Args, I>...>::value)...);
-            
-            return convert_return<Return>(result);
+            return (*function.m_function)(std::forward<Args>(args)...);
         }
 
-        template<bool Enable = true, std::size_t... I>
-        static enable_if_t<std::is_same<Return, void>::value && Enable, PyObject*>
-        wrapper_impl(PyObject *self, PyObject *args, std::index_sequence<I...>)
+        PyObject* call(PyObject* instance, PyObject* const* args, Py_ssize_t nargs) override
         {
-            std::initializer_list<const char *> formatList = {Object<Args>::Format...};
-            std::string format;
-            for (auto &subFormat : formatList)
-                format += subFormat;
+            return Dispatcher<Self, Return, Args...>::call(*this, instance, args, nargs);
+        }
 
-            char pythonArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::FromPythonType...>::value)];
-            char nativeArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::Type...>::value)];
-            {
-                CPYTHON_VERIFY(PyArg_ParseTuple(args, format.c_str(), (pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,
-                        ObjectWrapper<Args, I>...>::value)...), "Invalid argument was provided");
-            }
-    
-            ObjectPtr contextCapsule(PyTuple_GET_ITEM(self, 0), &Deleter::Borrow);
-            ObjectPtr hash_code(PyTuple_GET_ITEM(self, 1), &Deleter::Borrow);
-            unsigned long typed_hash_code = PyLong_AsUnsignedLong(hash_code.get());
-    
-            auto& context = *reinterpret_cast<ModuleContext*>(PyCapsule_GetPointer(contextCapsule.get(), nullptr));
-            context.get_function(typed_hash_code);
-    
-            Function& function = context.get_function(typed_hash_code);
-            Self& typedFunc = static_cast<Self&>(function);
-    
-            (*typedFunc.m_function)(std::forward<Args>(Object<Args>::get_typed(
-                    pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value,
-                    nativeArgsBuffer + ObjectOffset<ToNative, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value))...);
-
-            invoker(ObjectWrapper<Args, I>::destructor(nativeArgsBuffer +
-                ObjectOffset<ToNative, ObjectWrapper<Args, I>,
-                    ObjectWrapper<Args, I>...>::value)...);
-            
-            Py_XINCREF(Py_None);
-            return Py_None;
+        PyObject* map(PyObject* instance, PyObject* iterable) override
+        {
+            return Dispatcher<Self, Return, Args...>::map(*this, instance, iterable);
         }
 
-        static PyObject* wrapper(PyObject *self, PyObject *args)
+        PyObject* parallel_map(PyObject* instance, PyObject* iterable, std::size_t concurrency) override
         {
-            try
-            {
-                return wrapper_impl(self, args, std::make_index_sequence<sizeof...(Args)>{});
-            }
-            catch(const CPythonException& exc)
-            {
-                exc.raise();
-                return NULL;
-            }
+            return Dispatcher<Self, Return, Args...>::parallel_map(*this, instance, iterable, concurrency);
         }
 
-        MethodDefPtr to_python() const override
+        bool accepts(PyObject* const* args, Py_ssize_t nargs) const override
         {
-            return MethodDefPtr(new PyMethodDef{
-                    m_name.c_str(),
-                    &wrapper,
-                    METH_VARARGS,
-                    m_doc.c_str()
-            });
+            return ArgumentsMatcher<Args...>::match(args, nargs);
         }
 
     private:
@@ -2,12 +2,12 @@
 
 #include <Python.h>
 #include <type_traits>
-#include <initializer_list>
 #include <utility>
 #include <string>
 #include "../Core/Traits.h"
 #include "ClazzPyType.h"
 #include "CPythonObject.h"
+#include "ArgumentsParser.h"
 
 namespace sweetPy {
 
@@ -20,34 +20,35 @@ namespace sweetPy {
         Constructor &operator=(Constructor &&obj) = delete;
 
         template<std::size_t... I>
-        static int wrapper_impl(PyObject *self, PyObject *args, std::index_sequence<I...>) {
-            std::initializer_list<const char *> formatList = {Object<Args>::Format...};
-            std::string format;
-            for (auto &subFormat : formatList)
-                format += subFormat;
-
-            char pythonArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::FromPythonType...>::value)];
-            char nativeArgsBuffer[std::max(1, ObjectsPackSize<typename Object<Args>::Type...>::value)];
-            {
-                CPYTHON_VERIFY(PyArg_ParseTuple(args, format.c_str(), (pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,
-                        ObjectWrapper<Args, I>...>::value)...), "Invalid argument was provided");
-            }
+        static int wrapper_impl(PyObject *self, char* pythonArgsBuffer, std::index_sequence<I...>) {
+            char nativeArgsBuffer[ArgumentsParser<Args...>::NativeArgsSize];
             new(ClazzObject<ClassType>::get_val_offset(self))ClassType(std::forward<Args>(Object<Args>::get_typed(
-                    pythonArgsBuffer + ObjectOffset<FromPython, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value,
-                    nativeArgsBuffer + ObjectOffset<ToNative, ObjectWrapper<Args, I>,ObjectWrapper<Args, I>...>::value))...);
-    
-            ClazzObject<ClassType>::set_propertie(self, ClazzObject<ClassType>::Propertie::Value);
-            ClazzObject<ClassType>::set_hash(self);
-            
-            invoker(ObjectWrapper<Args, I>::destructor(nativeArgsBuffer +
-                ObjectOffset<ToNative, ObjectWrapper<Args, I>,
-                    ObjectWrapper<Args, I>...>::value)...);
+                    pythonArgsBuffer + ArgumentsParser<Args...>::PythonOffsets[I],
+                    nativeArgsBuffer + ArgumentsParser<Args...>::NativeOffsets[I]))...);
+
+            ArgumentsParser<Args...>::destroy(nativeArgsBuffer, std::index_sequence<I...>{});
             return 0;
         }
 
         static int wrapper(PyObject *self, PyObject *args, PyObject *kwargs)
         {
-            return wrapper_impl(self, args, std::make_index_sequence<sizeof...(Args)>{});
+            typedef std::make_index_sequence<sizeof...(Args)> Indices;
+            try
+            {
+                char pythonArgsBuffer[ArgumentsParser<Args...>::PythonArgsSize];
+#ifdef SWEETPY_FASTCALL_SUPPORT
+                //tp_init is always handed a tuple, its items are decoded in place.
+                ArgumentsParser<Args...>::parse(&PyTuple_GET_ITEM(args, 0), PyTuple_GET_SIZE(args), pythonArgsBuffer, Indices{});
+#else
+                ArgumentsParser<Args...>::parse(args, pythonArgsBuffer, Indices{});
+#endif
+                return wrapper_impl(self, pythonArgsBuffer, Indices{});
+            }
+            catch(const CPythonException& exc)
+            {
+                exc.raise();
+                return -1;
+            }
         }
 
     private:
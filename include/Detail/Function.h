@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Python.h>
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -8,9 +9,8 @@ namespace sweetPy {
     class Function
     {
     public:
-        typedef std::unique_ptr<PyMethodDef> MethodDefPtr;
         Function(const std::string& name, const std::string& doc)
-            :m_name(name), m_doc(doc), m_hash_code(std::hash<std::string>()(name))
+            :m_name(name), m_doc(doc), m_hash_code(std::hash<std::string>()(name)), m_releaseGil(false)
         {
         }
         virtual ~Function() = default;
@@ -18,12 +18,25 @@ namespace sweetPy {
         Function &operator=(Function &) = delete;
         Function(Function &&obj) = default;
         Function &operator=(Function &&obj) = default;
-        virtual MethodDefPtr to_python() const = 0;
+        //Invokes the function over an arguments vector, instance is nullptr for non member functions.
+        virtual PyObject* call(PyObject* instance, PyObject* const* args, Py_ssize_t nargs) = 0;
+        //Invokes the function over each element of iterable, returning a list of the results.
+        virtual PyObject* map(PyObject* instance, PyObject* iterable) = 0;
+        //As map, while the native invocations are distributed over up to concurrency threads without holding the GIL.
+        virtual PyObject* parallel_map(PyObject* instance, PyObject* iterable, std::size_t concurrency) = 0;
+        //Whether the arguments vector matches the function's signature, used for overload resolution.
+        virtual bool accepts(PyObject* const* args, Py_ssize_t nargs) const = 0;
+        const std::string& get_name() const {return m_name;}
+        const std::string& get_doc() const {return m_doc;}
         std::size_t get_hash_code() const {return m_hash_code;}
+        //When set, the GIL is released for the duration of the native call.
+        void set_release_gil(bool releaseGil){ m_releaseGil = releaseGil; }
+        bool is_releasing_gil() const {return m_releaseGil;}
 
     protected:
         std::string m_name;
         std::string m_doc;
         std::size_t m_hash_code;
+        bool m_releaseGil;
     };
 }
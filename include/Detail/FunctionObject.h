@@ -0,0 +1,50 @@
+#pragma once
+
+#include <Python.h>
+#include "../Types/ObjectPtr.h"
+#include "MethodDescriptor.h"
+#include "Function.h"
+
+namespace sweetPy {
+
+    /*
+     * Python callable of a bound function, optionally holding the instance it was bound to.
+     * Besides a regular invocation it exposes map, which applies the function over a whole sequence.
+     */
+    class FunctionObject
+    {
+    public:
+        static ObjectPtr create(Function& function, PyObject* instance);
+        //The function type of the current interpreter.
+        static PyTypeObject& get_type();
+        //The function type's definition, readied by every interpreter into a type of its own.
+        static PyTypeObject create_type();
+        //Module level parallel_map(function, iterable, threads=0), registered within every sweetPy module.
+        static PyMethodDef& get_parallel_map_def();
+
+    private:
+        struct CallableObject
+        {
+            PyObject m_object;
+#ifdef SWEETPY_VECTORCALL_SUPPORT
+            vectorcallfunc m_vectorcall;
+#endif
+            Function* m_function;
+            PyObject* m_instance;
+            bool m_bound;
+            PyObject* m_name;
+            PyObject* m_doc;
+        };
+#ifdef SWEETPY_VECTORCALL_SUPPORT
+        static PyObject* vectorcall(PyObject* callable, PyObject* const* args, size_t nargsf, PyObject* kwnames);
+#endif
+        static PyObject* call(PyObject* callable, PyObject* args, PyObject* kwargs);
+        static PyObject* map(PyObject* self, PyObject* iterable);
+        static PyObject* parallel_map(PyObject* module, PyObject* args, PyObject* kwargs);
+        static bool verify_bound(CallableObject& object);
+        static PyObject* repr(PyObject* self);
+        static int traverse(PyObject* self, visitproc visit, void* arg);
+        static int clear(PyObject* self);
+        static void dealloc(PyObject* self);
+    };
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Python.h>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "MetaClass.h"
+#include "TypesContainer.h"
+
+namespace sweetPy {
+
+    /*
+     * sweetPy's python state of a single interpreter - its types registry, the common meta type and the function
+     * and method descriptor types, so interpreters running sweetPy modules share no python objects.
+     * A state is created once an interpreter initializes its first sweetPy module, states are told apart by the
+     * interpreter's unique id and are released along with the interpreter's last sweetPy module.
+     */
+    class InterpreterState
+    {
+    public:
+        ~InterpreterState() = default;
+        InterpreterState(const InterpreterState&) = delete;
+        InterpreterState& operator=(const InterpreterState&) = delete;
+
+        //The state of the current interpreter, a process running a single interpreter skips resolving it.
+        static InterpreterState& get()
+        {
+            if(m_multiple.load(std::memory_order_acquire) == false)
+            {
+                InterpreterState* state = m_first.load(std::memory_order_acquire);
+                if(state != nullptr)
+                    return *state;
+            }
+            return acquire();
+        }
+        //Resolves the state of the current interpreter, creating it upon the interpreter's first request.
+        static InterpreterState& acquire();
+        static std::size_t get_count();
+        //A sweetPy module was initialized within the state's interpreter.
+        void add_module();
+        //A sweetPy module of the state's interpreter was freed, the last one releases the state.
+        static void release_module(InterpreterState& state);
+
+        std::int64_t get_id() const { return m_id; }
+        TypesContainer& get_types() { return m_types; }
+        MetaClass& get_common_meta_type() { return m_commonMetaType; }
+        PyTypeObject& get_function_type() { return m_functionType; }
+        PyTypeObject& get_method_descriptor_type() { return m_methodDescriptorType; }
+
+    private:
+        explicit InterpreterState(std::int64_t id);
+        static std::int64_t get_current_id()
+        {
+#if PY_VERSION_HEX >= 0x03090000
+            return PyInterpreterState_GetID(PyInterpreterState_Get());
+#else
+            return PyInterpreterState_GetID(PyThreadState_Get()->interp);
+#endif
+        }
+
+    private:
+        typedef std::unordered_map<std::int64_t, std::unique_ptr<InterpreterState>> States;
+        static std::mutex m_lock;
+        static States m_states;
+        static std::atomic<InterpreterState*> m_first;
+        static std::atomic<bool> m_multiple;
+        static std::atomic<std::uint64_t> m_generation;
+        std::int64_t m_id;
+        std::size_t m_modules;
+        TypesContainer m_types;
+        MetaClass m_commonMetaType;
+        PyTypeObject m_functionType;
+        PyTypeObject m_methodDescriptorType;
+    };
+}
@@ -9,6 +9,7 @@
 #include "ClazzContext.h"
 #include "CPythonType.h"
 #include "Function.h"
+#include "FunctionObject.h"
 #include <iostream>
 
 namespace sweetPy {
@@ -42,8 +43,9 @@ namespace sweetPy {
             clear_trace_ref();
             init_static_methods();
         }
-        static MetaClass& get_common_meta_type(){ return m_commonMetaType; }
-        static Py_ssize_t get_check_sum(){ return 0xABCCBA; }
+        //The common meta type of the current interpreter.
+        static MetaClass& get_common_meta_type();
+        static Py_ssize_t get_check_sum(){ return MetaCheckSum; }
         void add_static_method(FunctionPtr&& function)
         {
             m_staticMethods.emplace_back(std::move(function));
@@ -61,20 +63,15 @@ namespace sweetPy {
                 for(auto& method : m_staticMethods)
                 {
                     auto hashCodeVal = method->get_hash_code();
-                    auto descriptor = method->to_python();
-                    ObjectPtr name(PyUnicode_FromString(descriptor->ml_name), &Deleter::Owner);
-                    ObjectPtr hash_code(PyLong_FromUnsignedLong(hashCodeVal), &Deleter::Owner);
-    
-                    ObjectPtr self(PyTuple_New(2), &Deleter::Owner); //self = name and object, function will release the tuple
-    
-                    ObjectPtr type(PyCapsule_New(this, nullptr,[](PyObject*){}), &Deleter::Owner);
-                    PyTuple_SetItem(self.get(), 0, type.release());
-                    PyTuple_SetItem(self.get(), 1, hash_code.release());
-                    
-                    ObjectPtr cFunction(PyCFunction_NewEx(descriptor.release(), self.release(), NULL), &Deleter::Owner);
-                    PyDict_SetItem(ht_type.tp_dict, name.get(), cFunction.get());
-    
-                    m_context->add_member_function(hashCodeVal, std::move(method));
+                    m_context->add_member_static_function(hashCodeVal, std::move(method));
+                }
+                //Overloads are merged by the context, functions are exposed only once all were added.
+                for(auto& methodPair : m_context->get_member_static_functions())
+                {
+                    Function& method = *methodPair.second;
+                    ObjectPtr name(PyUnicode_InternFromString(method.get_name().c_str()), &Deleter::Owner);
+                    ObjectPtr function = FunctionObject::create(method, nullptr);
+                    PyDict_SetItem(ht_type.tp_dict, name.get(), function.get());
                 }
             }
         }
@@ -90,7 +87,6 @@ namespace sweetPy {
         }
         
     private:
-        static MetaClass m_commonMetaType;
         ClazzContextPtr m_context;
         typedef std::vector<FunctionPtr> StaticMethods;
         StaticMethods m_staticMethods;
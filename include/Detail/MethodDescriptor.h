@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Python.h>
+#include "../Types/ObjectPtr.h"
+#include "Function.h"
+
+#if PY_VERSION_HEX >= 0x03080000
+#define SWEETPY_VECTORCALL_SUPPORT
+#if PY_VERSION_HEX >= 0x03090000
+#define SWEETPY_TPFLAGS_HAVE_VECTORCALL Py_TPFLAGS_HAVE_VECTORCALL
+#else
+#define SWEETPY_TPFLAGS_HAVE_VECTORCALL _Py_TPFLAGS_HAVE_VECTORCALL
+#endif
+#endif
+
+namespace sweetPy {
+
+    /*
+     * Member functions are exposed as method descriptors, the interpreter invokes them with the instance
+     * as the first argument, so LOAD_METHOD/CALL_METHOD never creates a bound object.
+     */
+    class MethodDescriptor
+    {
+    public:
+        static ObjectPtr create(PyTypeObject* type, Function& function);
+        //The method descriptor type of the current interpreter.
+        static PyTypeObject& get_type();
+        //The method descriptor type's definition, readied by every interpreter into a type of its own.
+        static PyTypeObject create_type();
+
+    private:
+        struct DescriptorObject
+        {
+            PyObject m_object;
+#ifdef SWEETPY_VECTORCALL_SUPPORT
+            vectorcallfunc m_vectorcall;
+#endif
+            PyTypeObject* m_type;
+            PyObject* m_name;
+            PyObject* m_doc;
+            Function* m_function;
+        };
+        static PyObject* invoke(DescriptorObject& descriptor, PyObject* const* args, Py_ssize_t nargs);
+#ifdef SWEETPY_VECTORCALL_SUPPORT
+        static PyObject* vectorcall(PyObject* callable, PyObject* const* args, size_t nargsf, PyObject* kwnames);
+#endif
+        static PyObject* call(PyObject* callable, PyObject* args, PyObject* kwargs);
+        static PyObject* get(PyObject* self, PyObject* object, PyObject* type);
+        static PyObject* repr(PyObject* self);
+        static int traverse(PyObject* self, visitproc visit, void* arg);
+        static void dealloc(PyObject* self);
+    };
+}
@@ -6,6 +6,7 @@
 #include "Function.h"
 
 namespace sweetPy{
+    //Populated while the module initializes and immutable afterwards, so read without locking.
     class ModuleContext
     {
     public:
@@ -1,7 +1,6 @@
 #pragma once
 
 #include <Python.h>
-#include <bitset>
 #include "../Core/Traits.h"
 #include "../Core/Utils.h"
 #include "CPythonType.h"
@@ -9,45 +8,26 @@
 
 
 namespace sweetPy {
+    /*
+     * Instance layout of the sweetPy types, value and reference instances are told apart by their type,
+     * values of T are instances of the type registered for T while references are instances of the type
+     * registered for ReferenceObject<T>.
+     */
     template<typename T>
     struct ClazzObject
     {
-#define PROPERTIE_SIZE 1
-        enum Propertie
-        {
-            Value = 0,
-            Reference = 1,
-            All = 2
-        };
-        constexpr ClazzObject()
-        {
-            static_assert(sizeof(PyObject) >= sizeof(std::bitset<Propertie::All>), "Symbol set is not packed after PyObject due to aligment");
-        }
+        ClazzObject() = delete; //Instances are laid over python allocated memory.
         constexpr static std::size_t get_size()
         {
             return sizeof(ClazzObject);
         }
-        static void set_propertie(void* ptr, Propertie propertie)
-        {
-            auto objectPtr = reinterpret_cast<ClazzObject*>(ptr);
-            objectPtr->m_propertie[propertie] = true;
-        }
-        static void set_hash(void* ptr)
-        {
-            auto objectPtr = reinterpret_cast<ClazzObject*>(ptr);
-            objectPtr->m_hash = Hash::generate_hash_code<T>();
-        }
         static bool is_ref(void* ptr)
         {
-            auto objectPtr = reinterpret_cast<ClazzObject*>(ptr);
-            return objectPtr->m_propertie[Reference] == true &&
-                objectPtr->m_hash == Hash::generate_hash_code<T>();
+            return is_instance(ptr);
         }
         static bool is_val(void* ptr)
         {
-            auto objectPtr = reinterpret_cast<ClazzObject*>(ptr);
-            return objectPtr->m_propertie[Value] == true &&
-                   objectPtr->m_hash == Hash::generate_hash_code<T>();
+            return is_instance(ptr);
         }
         static T& get_val(void* ptr)
         {
@@ -62,10 +42,20 @@ namespace sweetPy {
             return (char*)&reinterpret_cast<ClazzObject*>(ptr)->m_val;
         }
     
+    private:
+        static bool is_instance(void* ptr)
+        {
+            CPythonType* type = TypeSlot<T>::m_type.load(std::memory_order_acquire);
+            if(type != nullptr && Py_TYPE(reinterpret_cast<PyObject*>(ptr)) == &type->ht_type)
+                return true;
+            //Types of interpreters other than the one bound to the slot are told by their identity.
+            type = CPythonType::find_type(Py_TYPE(reinterpret_cast<PyObject*>(ptr)));
+            return type != nullptr && type->get_identity() == Hash::generate_tag<typename TypeIdentity<T>::Base>() &&
+                   type->get_category() == TypeIdentity<T>::Category;
+        }
+
     private:
         PyObject m_object;
-        std::bitset<PROPERTIE_SIZE> m_propertie;
-        std::size_t m_hash;
         T m_val;
     };
     
@@ -75,11 +65,9 @@ namespace sweetPy {
         template<typename X = _T, typename = enable_if_t<std::is_copy_constructible<X>::value>>
         static PyObject *alloc(const _T &object)
         {
-            CPythonType& type = TypesContainer::instance().get_type(Hash::generate_hash_code<_T>());
+            CPythonType& type = TypesContainer::instance().get_type<_T>();
             PyObject *ptr = type.ht_type.tp_alloc(&type.ht_type, 0);
             new(ClazzObject<_T>::get_val_offset(ptr))_T(object);
-            ClazzObject<_T>::set_propertie(ptr, ClazzObject<_T>::Propertie::Value);
-            ClazzObject<_T>::set_hash(ptr);
             return ptr;
         }
         template<typename X = _T, typename = enable_if_t<!std::is_copy_constructible<X>::value &&
@@ -87,11 +75,9 @@ namespace sweetPy {
                 >
         static PyObject *alloc(_T &&object)
         {
-            CPythonType& type = TypesContainer::instance().get_type(Hash::generate_hash_code<_T>());
+            CPythonType& type = TypesContainer::instance().get_type<_T>();
             PyObject *ptr = type.ht_type.tp_alloc(&type.ht_type, 0);
             new(ClazzObject<_T>::get_val_offset(ptr))_T(std::move(object));
-            ClazzObject<_T>::set_propertie(ptr, ClazzObject<_T>::Propertie::Value);
-            ClazzObject<_T>::set_hash(ptr);
             return ptr;
         }
     };
@@ -107,15 +93,51 @@ namespace sweetPy {
         
         static PyObject *alloc(_T &object)
         {
-            CPythonType& type = TypesContainer::instance().get_type(Hash::generate_hash_code<Self>());
+            CPythonType& type = TypesContainer::instance().get_type<Self>();
             PyObject *ptr = type.ht_type.tp_alloc(&type.ht_type, 0);
             new(ClazzObject<Self>::get_val_offset(ptr))Self(object);
-            ClazzObject<Self>::set_propertie(ptr, ClazzObject<Self>::Reference);
-            ClazzObject<Self>::set_hash(ptr);
             return ptr;
         }
     
     private:
         _T &m_ref;
     };
+
+    /*
+     * Resolves python instances of the sweetPy types registered for T, const T and their reference wrappers,
+     * a single probe of the instance's type yields both whether it is an instance of T and its category.
+     */
+    template<typename T>
+    struct Instance
+    {
+        typedef typename std::remove_const<T>::type Base;
+
+        static TypeCategory get_category(PyObject* object)
+        {
+            CPythonType* type = CPythonType::find_type(Py_TYPE(object));
+            if(type == nullptr || type->get_identity() != Hash::generate_tag<Base>())
+                return TypeCategory::Foreign;
+            return type->get_category();
+        }
+        //nullptr is returned for foreign instances.
+        static Base* get(PyObject* object, TypeCategory category)
+        {
+            switch(category)
+            {
+                case TypeCategory::Value:
+                case TypeCategory::ConstValue:
+                    return reinterpret_cast<Base*>(ClazzObject<Base>::get_val_offset(object));
+                case TypeCategory::Reference:
+                    return &ClazzObject<ReferenceObject<Base>>::get_val(object).get_ref();
+                case TypeCategory::ConstReference:
+                    return const_cast<Base*>(&ClazzObject<ReferenceObject<const Base>>::get_val(object).get_ref());
+                default:
+                    return nullptr;
+            }
+        }
+        static bool is_const(TypeCategory category)
+        {
+            return category == TypeCategory::ConstValue || category == TypeCategory::ConstReference;
+        }
+    };
 }
@@ -0,0 +1,220 @@
+#pragma once
+
+#include <Python.h>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "core/Source.h"
+#include "../Core/SPException.h"
+#include "../Core/Assert.h"
+#include "../Core/Deleter.h"
+#include "../Types/ObjectPtr.h"
+#include "Function.h"
+
+namespace sweetPy {
+
+    /*
+     * Several functions bound under a single name, the call is dispatched to the first overload, in
+     * registration order, whose signature matches the arguments. Matching depends only upon the arguments'
+     * types, so the last resolved types vector is cached, repeated calls of the same signature skip resolution.
+     */
+    class OverloadedFunction : public Function
+    {
+    public:
+        typedef std::shared_ptr<Function> FunctionPtr;
+
+        OverloadedFunction(const std::string& name, const std::string& doc)
+            :Function(name, doc), m_cache{} {}
+        virtual ~OverloadedFunction() = default;
+
+        //Binds overload under existing's name, existing is replaced by an overloaded function if required.
+        template<typename Ptr>
+        static void merge(Ptr& existing, Ptr&& overload)
+        {
+            auto overloaded = dynamic_cast<OverloadedFunction*>(existing.get());
+            if(overloaded == nullptr)
+            {
+                overloaded = new OverloadedFunction(existing->get_name(), existing->get_doc());
+                Ptr function(overloaded);
+                overloaded->add_overload(std::move(existing));
+                existing = std::move(function);
+            }
+            overloaded->add_overload(std::move(overload));
+        }
+
+        void add_overload(FunctionPtr&& overload)
+        {
+            m_overloads.emplace_back(std::move(overload));
+            m_cache = Cache{};
+        }
+
+        PyObject* call(PyObject* instance, PyObject* const* args, Py_ssize_t nargs) override
+        {
+            try
+            {
+                return resolve(args, nargs).call(instance, args, nargs);
+            }
+            catch(const CPythonException& exc)
+            {
+                exc.raise();
+                return NULL;
+            }
+        }
+
+        //Each element is resolved on its own, a tuple element is unpacked if it matches any of the overloads.
+        PyObject* map(PyObject* instance, PyObject* iterable) override
+        {
+            try
+            {
+                ObjectPtr sequence(PySequence_Fast(iterable, "map expects an iterable"), &Deleter::Owner);
+                if(sequence.get() == nullptr)
+                    return NULL;
+                Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence.get());
+                PyObject** items = PySequence_Fast_ITEMS(sequence.get());
+                ObjectPtr results(PyList_New(size), &Deleter::Owner);
+                CPYTHON_VERIFY(results.get() != nullptr, "Results list allocation failed");
+
+                for(Py_ssize_t index = 0; index < size; index++)
+                {
+                    PyObject* const* args = nullptr;
+                    Py_ssize_t nargs = 0;
+                    Function& overload = resolve_element(items[index], args, nargs);
+                    PyObject* result = overload.call(instance, args, nargs);
+                    if(result == nullptr)
+                        return NULL;
+                    PyList_SET_ITEM(results.get(), index, result);
+                }
+                return results.release();
+            }
+            catch(const CPythonException& exc)
+            {
+                exc.raise();
+                return NULL;
+            }
+        }
+
+        //Each element is resolved on its own, the elements of every resolved overload are run as a batch of their own.
+        PyObject* parallel_map(PyObject* instance, PyObject* iterable, std::size_t concurrency) override
+        {
+            try
+            {
+                ObjectPtr sequence(PySequence_Fast(iterable, "parallel_map expects an iterable"), &Deleter::Owner);
+                if(sequence.get() == nullptr)
+                    return NULL;
+                Py_ssize_t size = PySequence_Fast_GET_SIZE(sequence.get());
+                PyObject** items = PySequence_Fast_ITEMS(sequence.get());
+
+                std::vector<std::pair<Function*, std::vector<Py_ssize_t>>> batches;
+                for(Py_ssize_t index = 0; index < size; index++)
+                {
+                    PyObject* const* args = nullptr;
+                    Py_ssize_t nargs = 0;
+                    Function* overload = &resolve_element(items[index], args, nargs);
+                    auto batch = std::find_if(batches.begin(), batches.end(), [overload](const auto& batch){ return batch.first == overload; });
+                    if(batch == batches.end())
+                        batch = batches.emplace(batches.end(), overload, std::vector<Py_ssize_t>());
+                    batch->second.emplace_back(index);
+                }
+
+                ObjectPtr results(PyList_New(size), &Deleter::Owner);
+                CPYTHON_VERIFY(results.get() != nullptr, "Results list allocation failed");
+                for(auto& batch : batches)
+                {
+                    ObjectPtr elements(PyList_New(batch.second.size()), &Deleter::Owner);
+                    CPYTHON_VERIFY(elements.get() != nullptr, "Batch list allocation failed");
+                    for(std::size_t position = 0; position < batch.second.size(); position++)
+                    {
+                        PyObject* element = items[batch.second[position]];
+                        Py_INCREF(element);
+                        PyList_SET_ITEM(elements.get(), position, element);
+                    }
+                    ObjectPtr batchResults(batch.first->parallel_map(instance, elements.get(), concurrency), &Deleter::Owner);
+                    if(batchResults.get() == nullptr)
+                        return NULL;
+                    for(std::size_t position = 0; position < batch.second.size(); position++)
+                    {
+                        PyObject* result = PyList_GET_ITEM(batchResults.get(), position);
+                        Py_INCREF(result);
+                        PyList_SET_ITEM(results.get(), batch.second[position], result);
+                    }
+                }
+                return results.release();
+            }
+            catch(const CPythonException& exc)
+            {
+                exc.raise();
+                return NULL;
+            }
+        }
+
+        bool accepts(PyObject* const* args, Py_ssize_t nargs) const override
+        {
+            for(auto& overload : m_overloads)
+                if(overload->accepts(args, nargs))
+                    return true;
+            return false;
+        }
+
+    private:
+        static const Py_ssize_t MaxCachedArgs = 6;
+        struct Cache
+        {
+            Function* m_overload;
+            Py_ssize_t m_nargs;
+            std::array<PyTypeObject*, MaxCachedArgs> m_types;
+        };
+
+        bool is_cached(PyObject* const* args, Py_ssize_t nargs) const
+        {
+            if(m_cache.m_overload == nullptr || m_cache.m_nargs != nargs)
+                return false;
+            for(Py_ssize_t index = 0; index < nargs; index++)
+                if(m_cache.m_types[index] != Py_TYPE(args[index]))
+                    return false;
+            return true;
+        }
+
+        Function& resolve(PyObject* const* args, Py_ssize_t nargs)
+        {
+            if(is_cached(args, nargs))
+                return *m_cache.m_overload;
+
+            for(auto& overload : m_overloads)
+            {
+                if(overload->accepts(args, nargs))
+                {
+                    if(nargs <= MaxCachedArgs)
+                    {
+                        m_cache.m_overload = overload.get();
+                        m_cache.m_nargs = nargs;
+                        for(Py_ssize_t index = 0; index < nargs; index++)
+                            m_cache.m_types[index] = Py_TYPE(args[index]);
+                    }
+                    return *overload;
+                }
+            }
+            throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "No matching overload of %s was found for the provided %d arguments",
+                                   m_name.c_str(), (int)nargs);
+        }
+
+        Function& resolve_element(PyObject* const& element, PyObject* const*& args, Py_ssize_t& nargs)
+        {
+            if(PyTuple_Check(element))
+            {
+                args = &PyTuple_GET_ITEM(element, 0);
+                nargs = PyTuple_GET_SIZE(element);
+                if(accepts(args, nargs))
+                    return resolve(args, nargs);
+            }
+            args = &element;
+            nargs = 1;
+            return resolve(args, nargs);
+        }
+
+    private:
+        std::vector<FunctionPtr> m_overloads;
+        Cache m_cache;
+    };
+}
@@ -10,7 +10,8 @@ namespace sweetPy{
     {
     public:
         typedef std::function<void(PyObject*)> DeallocObject;
-        PlainType(const std::string &name, const std::string &doc, Py_ssize_t size, std::size_t hash_code, const DeallocObject& dealloc)
+        PlainType(const std::string &name, const std::string &doc, Py_ssize_t size, std::size_t hash_code, const DeallocObject& dealloc,
+                  std::size_t alignment = 0)
                 : CPythonType(name, doc, hash_code, std::forward<DeallocObject>(free_type)), m_dealloc(dealloc)
         {
             ht_type.ob_base.ob_base.ob_type = &MetaClass::get_common_meta_type().ht_type;
@@ -22,6 +23,7 @@ namespace sweetPy{
             ht_type.tp_flags = Py_TPFLAGS_HEAPTYPE;
             ht_type.tp_setattro = &set_attribute;
             ht_type.tp_new = PyBaseObject_Type.tp_new;
+            set_alignment(alignment);
         }
         bool is_finalized() const { return m_isFinalized; }
         const DeallocObject& get_dealloc() const {return m_dealloc;}
@@ -1,43 +1,81 @@
 #pragma once
 
-#include "MemberAccessor.h"
-#include "ClazzPyType.h"
+#include <Python.h>
+#include <cstdint>
+#include <type_traits>
+#include "core/Source.h"
+#include "../Core/Traits.h"
+#include "../Core/SPException.h"
+#include "Object.h"
 #include "CPythonObject.h"
 
 namespace sweetPy{
+    /*
+     * Get set functions for a member of a given type, each member type instantiates its own
+     * getter and setter, the member's offset within Type is provided through the closure.
+     */
     template<typename Type, typename MemberT>
-    class TypedMemberAccessor : public MemberAccessor
+    struct TypedMemberAccessor
     {
-    public:
-        explicit TypedMemberAccessor(int offset) : m_offset(offset) {}
-        virtual ~TypedMemberAccessor() = default;
-        
+        static MemberT& get_member(PyObject *object, void *closure)
+        {
+            return *reinterpret_cast<MemberT*>(ClazzObject<Type>::get_val_offset(object) + reinterpret_cast<intptr_t>(closure));
+        }
+
+        static PyObject* get(PyObject *object, void *closure)
+        {
+            try
+            {
+                return Object<MemberT>::to_python(get_member(object, closure));
+            }
+            catch(const CPythonException& exception)
+            {
+                exception.raise();
+                return NULL;
+            }
+        }
+
         /*
          * Set will receive the rhs object, the object may be a reference wrapper
          * /a python supported type/a C++ type.
          */
-        void set(PyObject *object, PyObject *rhs) override
+        static int set(PyObject *object, PyObject *rhs, void *closure)
         {
-            MemberT &member = *(MemberT*) (reinterpret_cast<char*>(&ClazzObject<Type>::get_val(object)) + m_offset);
-            if (ClazzObject<ReferenceObject<MemberT>>::is_ref(rhs))
+            try
             {
-                MemberT& _rhs = Object<MemberT&>::from_python(rhs);
-                member = _rhs;
+                if(rhs == nullptr)
+                    throw CPythonException(PyExc_TypeError, __CORE_SOURCE, "Member deletion is not supported");
+
+                MemberT &member = get_member(object, closure);
+                if (ClazzObject<ReferenceObject<MemberT>>::is_ref(rhs))
+                {
+                    MemberT& _rhs = Object<MemberT&>::from_python(rhs);
+                    member = _rhs;
+                }
+                else
+                {
+                    auto _rhs = Object<MemberT>::from_python(rhs);
+                    member = _rhs;
+                }
+                return 0;
             }
-            else
+            catch(const CPythonException& exception)
             {
-                auto _rhs = Object<MemberT>::from_python(rhs);
-                member = _rhs;
+                exception.raise();
+                return -1;
             }
         }
-        
-        PyObject* get(PyObject *object) override
+
+        template<typename X = MemberT>
+        static enable_if_t<std::is_same<X, typename std::remove_const<X>::type>::value, setter> get_setter()
+        {
+            return &set;
+        }
+
+        template<typename X = MemberT>
+        static enable_if_t<!std::is_same<X, typename std::remove_const<X>::type>::value, setter> get_setter()
         {
-            MemberT& member = *(MemberT*) (reinterpret_cast<char*>(&ClazzObject<Type>::get_val(object)) + m_offset);
-            return Object<MemberT>::to_python(member);
+            return nullptr;
         }
-    
-    private:
-        int m_offset;
     };
-}
\ No newline at end of file
+}
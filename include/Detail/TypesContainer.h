@@ -1,29 +1,95 @@
 #pragma once
 
 #include <Python.h>
+#include <atomic>
 #include <unordered_map>
+#include <type_traits>
 #include "../Core/SPException.h"
+#include "../Core/Utils.h"
 #include "CPythonType.h"
 
 namespace sweetPy{
+    //The type registered for T, reset once the type is destroyed. Read without locking, by conversions on any thread.
+    //Bound by the first interpreter registering T, the registries of other interpreters resolve T by its hash code.
+    template<typename T>
+    struct TypeSlot
+    {
+        static inline std::atomic<CPythonType*> m_type{nullptr};
+    };
+
+    template<typename T, typename _T>
+    class ReferenceObject;
+
+    //Decomposes a registered native type into its identity and category.
+    template<typename T>
+    struct TypeIdentity
+    {
+        typedef T Base;
+        static constexpr TypeCategory Category = TypeCategory::Value;
+    };
+    template<typename T>
+    struct TypeIdentity<const T>
+    {
+        typedef T Base;
+        static constexpr TypeCategory Category = TypeCategory::ConstValue;
+    };
+    template<typename T, typename _T>
+    struct TypeIdentity<ReferenceObject<T, _T>>
+    {
+        typedef typename std::remove_const<_T>::type Base;
+        static constexpr TypeCategory Category = std::is_const<_T>::value ? TypeCategory::ConstReference : TypeCategory::Reference;
+    };
+
+    //Registry of the types of a single interpreter.
     class TypesContainer
     {
     private:
         typedef std::unordered_map<std::size_t, std::reference_wrapper<CPythonType>> Types;
         
     public:
-        static TypesContainer& instance()
+        TypesContainer() = default;
+        //Types outliving the registry, leaked by their module, must not refer to it anymore.
+        ~TypesContainer()
         {
-            static TypesContainer instance;
-            return instance;
+            for(auto& typePair : m_types)
+                typePair.second.get().unbind();
         }
-        ~TypesContainer() = default;
+        TypesContainer(const TypesContainer&) = delete;
+        TypesContainer& operator=(const TypesContainer&) = delete;
+        //The registry of the current interpreter.
+        static TypesContainer& instance();
         void add_type(std::size_t hash_code_key, CPythonType& type, bool force = false)
         {
             if(force)
                 m_types.erase(hash_code_key);
             
             m_types.insert({hash_code_key, type});
+            type.bind_container(this);
+        }
+        //Registers type as T's type, T's type slot is bound to type, sparing the hash lookup upon get_type<T>.
+        template<typename T>
+        void add_type(CPythonType& type, bool force = false)
+        {
+            add_type(Hash::generate_hash_code<T>(), type, force);
+            std::atomic<CPythonType*>& slot = TypeSlot<T>::m_type;
+            CPythonType* empty = nullptr;
+            if(force)
+                slot.store(&type, std::memory_order_release);
+            if(force || slot.compare_exchange_strong(empty, &type, std::memory_order_acq_rel))
+                type.bind_slot(&slot);
+            type.set_identity(Hash::generate_tag<typename TypeIdentity<T>::Base>(), TypeIdentity<T>::Category);
+        }
+        template<typename T>
+        CPythonType& get_type()
+        {
+            CPythonType* type = TypeSlot<T>::m_type.load(std::memory_order_acquire);
+            return type != nullptr && type->get_container() == this ? *type : get_type(Hash::generate_hash_code<T>());
+        }
+        template<typename T>
+        CPythonType* find_type()
+        {
+            CPythonType* type = TypeSlot<T>::m_type.load(std::memory_order_acquire);
+            return type != nullptr && type->get_container() == this ? type : find_type(Hash::generate_hash_code<T>());
         }
         CPythonType& get_type(std::size_t hash_code_key)
         {
@@ -32,6 +98,19 @@ namespace sweetPy{
                 throw CPythonException(PyExc_KeyError, __CORE_SOURCE, "Requested type - %d, wasn't found", hash_code_key);
             return it->second.get();
         }
+        //Removes the registration of hash_code_key, given it still refers to type.
+        void remove_type(std::size_t hash_code_key, const CPythonType& type)
+        {
+            auto it = m_types.find(hash_code_key);
+            if(it != m_types.end() && &it->second.get() == &type)
+                m_types.erase(it);
+        }
+        //As get_type, nullptr is returned for an unregistered type.
+        CPythonType* find_type(std::size_t hash_code_key)
+        {
+            auto it = m_types.find(hash_code_key);
+            return it == m_types.end() ? nullptr : &it->second.get();
+        }
 
     private:
         Types m_types;
@@ -14,10 +14,7 @@
 #define INIT_MODULE(name, doc) \
 void initialize_module(sweetPy::Module& module); \
 PyMODINIT_FUNC PyInit_##name() { \
-    sweetPy::Module module(#name, doc); \
-    sweetPy::MetaClass::get_common_meta_type().finalize(); \
-    initialize_module(module); \
-    module.finalize();\
-    return module.get_module(); \
+    static sweetPy::ModuleDefinition definition(#name, doc, &initialize_module); \
+    return definition.init(); \
 } \
 void initialize_module(sweetPy::Module& module)
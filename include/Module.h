@@ -16,13 +16,14 @@
 #include "Detail/CPythonObject.h"
 #include "Detail/Function.h"
 #include "Detail/ConcreteFunction.h"
+#include "Detail/OverloadedFunction.h"
+#include "Detail/FunctionObject.h"
 #include "Detail/ModuleContext.h"
+#include "Detail/InterpreterState.h"
 #include "Detail/PlainType.h"
 #include "Detail/Object.h"
 
 namespace sweetPy {
-    class MetaClass;
-    extern MetaClass* commonMetaTypePtr;
     class Variable {
     public:
         typedef std::unique_ptr<Variable> VariablePtr;
@@ -53,8 +54,15 @@ namespace sweetPy {
     class Module
     {
     private:
+        friend class ModuleDefinition;
         typedef std::unique_ptr<Function> FunctionPtr;
         typedef std::size_t TypeKey;
+        //Per module state, the module's context is owned by the module object, the module holds its interpreter's state.
+        struct State
+        {
+            ModuleContext* m_context;
+            InterpreterState* m_interpreter;
+        };
     
         template<typename...>
         struct TypesInitializer{};
@@ -74,10 +82,10 @@ namespace sweetPy {
                 };
                 std::size_t hashCode = Hash::generate_hash_code<T>();
                 
-                std::unique_ptr<PyObject, std::function<void(PyObject*)>> plainType(
+                ObjectPtr plainType(
                         CPythonType::get_py_object(
                                 new PlainType(namePrefix + std::to_string(hashCode), "", ClazzObject<T>::get_size(),
-                                              hashCode, objectDestroyer)
+                                              hashCode, objectDestroyer, alignof(ClazzObject<T>))
                         ),
                         [](PyObject* ptr){
                             auto plainType = static_cast<PlainType*>(CPythonType::get_type(ptr));
@@ -105,7 +113,8 @@ namespace sweetPy {
                 if(!module.is_type_exists(type.get_hash_code()))
                 {
                     static_cast<PlainType&>(type).finalize();
-                    TypesContainer::instance().add_type(type.get_hash_code(), type, false);
+                    type.enable_free_list(module.get_free_list_capacity());
+                    TypesContainer::instance().add_type<T>(type, false);
                     module.add_type(type.get_hash_code(), std::move(plainType), false);
                 }
                 return nullptr;
@@ -125,7 +134,7 @@ namespace sweetPy {
             static void* initialize_type(Module& module, const std::string& namePrefix)
             {
                 std::size_t hashCode = Hash::generate_hash_code<ReferenceObject<_T>>();
-                std::unique_ptr<PyObject, std::function<void(PyObject*)>> plainType(
+                ObjectPtr plainType(
                         CPythonType::get_py_object(
                             new PlainType(namePrefix + std::to_string(hashCode), "", ClazzObject<ReferenceObject<_T>>::get_size(),
                                 hashCode, [](PyObject*){})
@@ -156,7 +165,8 @@ namespace sweetPy {
                 if(!module.is_type_exists(type.get_hash_code()))
                 {
                     static_cast<PlainType&>(type).finalize();
-                    TypesContainer::instance().add_type(type.get_hash_code(), type, false);
+                    type.enable_free_list(module.get_free_list_capacity());
+                    TypesContainer::instance().add_type<ReferenceObject<_T>>(type, false);
                     module.add_type(type.get_hash_code(), std::move(plainType), false);
                 }
                 return nullptr;
@@ -217,12 +227,18 @@ namespace sweetPy {
     public:
         explicit Module(const std::string &name, const std::string &doc)
             :m_moduleDef(nullptr), m_module(nullptr, &Deleter::Borrow),
-             m_context(new ModuleContext()), m_name(name), m_doc(doc)
+             m_context(new ModuleContext()), m_name(name), m_doc(doc), m_freeListCapacity(0)
          {
             auto moduleDef = (PyModuleDef*)malloc(sizeof(PyModuleDef));
             new(moduleDef)PyModuleDef{};
             m_moduleDef.reset(moduleDef);
          }
+        //Populates a module object already created by the interpreter, see ModuleDefinition.
+        explicit Module(PyObject* module)
+            :m_moduleDef(nullptr), m_module(module, &Deleter::Borrow),
+             m_context(new ModuleContext()), m_name(PyModule_GetName(module)), m_freeListCapacity(0)
+        {
+        }
         ~Module() = default;
         void add_type(TypeKey key, ObjectPtr&& type, bool isForceInsertion = true)
         {
@@ -235,6 +251,9 @@ namespace sweetPy {
         {
             return m_types.find(key) != m_types.end();
         }
+        //Plain types generated from here on allocate their instances through free lists retaining up to capacity instances each.
+        void enable_free_list(std::size_t capacity){ m_freeListCapacity = capacity; }
+        std::size_t get_free_list_capacity() const { return m_freeListCapacity; }
         template<typename T>
         void add_variable(const std::string& name, T&& value)
         {
@@ -243,12 +262,19 @@ namespace sweetPy {
         template<typename X, typename = enable_if_t<std::is_function<typename std::remove_pointer<X>::type>::value>>
         void add_function(const std::string &name, const std::string &doc, X &&function)
         {
+            typedef CFunction<X> CPyFuncType;
+            add_function(FunctionPtr(new CPyFuncType(name, doc, function)));
+            FunctionTypesInitializer<X>::initialize_types(*this, "Clazz");
+        }
+        template<typename X, typename = enable_if_t<std::is_function<typename std::remove_pointer<X>::type>::value>>
+        void add_function(const std::string &name, const std::string &doc, X &&function, ReleaseGil)
+        {
+            static_assert(!is_python_signature<std::decay_t<X>>::value, "Functions taking or returning python objects require the GIL");
             typedef CFunction<X> CPyFuncType;
             FunctionPtr functionPtr(new CPyFuncType(name, doc, function));
-            auto pair = m_functions.insert(std::make_pair(functionPtr->get_hash_code(), std::move(functionPtr)));
+            functionPtr->set_release_gil(true);
+            add_function(std::move(functionPtr));
             FunctionTypesInitializer<X>::initialize_types(*this, "Clazz");
-            if(!pair.second)
-                throw CPythonException(PyExc_KeyError, __CORE_SOURCE, "function key already in use");
         }
         Function& get_function(std::size_t hash_code)
         {
@@ -260,25 +286,17 @@ namespace sweetPy {
         }
         void init_functions()
         {
+            ObjectPtr parallelMap(PyCFunction_NewEx(&FunctionObject::get_parallel_map_def(), nullptr, nullptr), &Deleter::Owner);
+            CPYTHON_VERIFY(PyModule_AddObject((PyObject*)m_module.get(), "parallel_map", parallelMap.release()) == 0,
+                           "parallel_map registration with module failed");
             if(!m_functions.empty())
             {
                 for (auto &functionPair : m_functions)
                 {
-                    auto descriptor = functionPair.second->to_python();
                     std::size_t hashCode = functionPair.second->get_hash_code();
-    
-                    ObjectPtr self(PyTuple_New(2), &Deleter::Owner); //self = name and object, function will release the tuple
-                    
-                    ObjectPtr context(PyCapsule_New(m_context.get(), nullptr, nullptr), &Deleter::Owner);
-                    CPYTHON_VERIFY(context.get() != nullptr, "Encapsulating module context failed");
-                    PyTuple_SetItem(self.get(), 0, context.release());
-                    
-                    ObjectPtr hashCodePtr(PyLong_FromUnsignedLong(hashCode), &Deleter::Owner);
-                    PyTuple_SetItem(self.get(), 1, hashCodePtr.release());
-                    
-                    std::string name = descriptor->ml_name;
-                    ObjectPtr cFunction(PyCFunction_NewEx(descriptor.release(), self.get(), NULL), &Deleter::Owner);
-                    CPYTHON_VERIFY(PyModule_AddObject((PyObject*)m_module.get(), name.c_str(), cFunction.release()) == 0, "global function registration with module failed");
+                    ObjectPtr function = FunctionObject::create(*functionPair.second, nullptr);
+                    CPYTHON_VERIFY(PyModule_AddObject((PyObject*)m_module.get(), functionPair.second->get_name().c_str(), function.release()) == 0,
+                                   "global function registration with module failed");
                     
                     m_context->add_function(hashCode, std::move(functionPair.second));
                 }
@@ -289,7 +307,25 @@ namespace sweetPy {
             m_enums.emplace_back(name, std::move(dictionary));
         }
         PyObject* get_module() const{ return m_module.get(); }
+        //Single phase initialization creates the module object, modules bound to an existing object are only populated.
         void finalize()
+        {
+            if(m_module.get() == nullptr)
+                create_module();
+    
+            init_functions();
+            init_types();
+            init_variables();
+            init_enums();
+    
+            State& state = get_state(m_module.get());
+            state.m_context = m_context.release();
+            state.m_interpreter = &InterpreterState::acquire();
+            state.m_interpreter->add_module();
+        }
+
+    private:
+        void create_module()
         {
             char* name = new char[m_name.length() + 1];
             std::copy_n(m_name.c_str(), m_name.length(), name);
@@ -302,24 +338,27 @@ namespace sweetPy {
             m_moduleDef->m_base = PyModuleDef_HEAD_INIT;
             m_moduleDef->m_name = name;
             m_moduleDef->m_doc = doc;
+            m_moduleDef->m_size = sizeof(State);
             m_moduleDef->m_free = &free_module;
             m_moduleDef->m_clear = &clear_module;
             m_module.reset(PyModule_Create(m_moduleDef.get()));
             CPYTHON_VERIFY(m_module.get() != nullptr, "Module registration failed");
             m_moduleDef.release();
-    
-            init_functions();
-            init_types();
-            init_variables();
-            init_enums();
-    
-            ObjectPtr context(PyCapsule_New(m_context.get(), nullptr, nullptr), &Deleter::Owner);
-            CPYTHON_VERIFY(context.get() != nullptr, "Encapsulating module context failed");
-            m_context.release();
-            CPYTHON_VERIFY(PyModule_AddObject((PyObject*)m_module.get(), "context", context.release()) == 0, "module context registration with module failed");
         }
-
-    private:
+        static State& get_state(PyObject* module)
+        {
+            return *static_cast<State*>(PyModule_GetState(module));
+        }
+        //Functions bound under an already used name are merged into an overloaded function.
+        void add_function(FunctionPtr&& function)
+        {
+            std::size_t hashCode = function->get_hash_code();
+            auto it = m_functions.find(hashCode);
+            if(it != m_functions.end())
+                OverloadedFunction::merge(it->second, std::move(function));
+            else
+                m_functions.insert(std::make_pair(hashCode, std::move(function)));
+        }
         void init_variables()
         {
             if(m_variables.empty() == false)
@@ -360,6 +399,10 @@ namespace sweetPy {
         }
         static int clear_module(PyObject* object)
         {
+            State& state = get_state(object);
+            delete state.m_context;
+            state.m_context = nullptr;
+            
             PyObject* moduleDictPtr = get_module_instance_dict(object);
             if(moduleDictPtr == nullptr)
                 return 0;
@@ -372,16 +415,16 @@ namespace sweetPy {
                     types.emplace_back(reinterpret_cast<PyTypeObject*>(value));
             }
     
-            auto contextCapsule = moduleDict.get<ObjectPtr, const char*>("context");
-            auto context = reinterpret_cast<ModuleContext*>(PyCapsule_GetPointer(contextCapsule.get(), nullptr));
-            delete context;
-    
             moduleDict.clear();
     
             for(auto& type : types)
             {
                 Dictionary dict(type->tp_dict);
                 dict.clear();
+                //Static methods are held by the type's own meta class, which outlives a leaking type.
+                PyTypeObject* meta = type->ob_base.ob_base.ob_type;
+                if(meta != reinterpret_cast<PyTypeObject*>(CPythonType::get_py_object(&MetaClass::get_common_meta_type())))
+                    Dictionary(meta->tp_dict).clear();
         
                 Py_XDECREF(type->tp_mro);
                 type->tp_mro = nullptr;
@@ -408,6 +451,16 @@ namespace sweetPy {
             delete [] moduleDef.m_doc;
             
             clear_module(objectPtr);
+            release_interpreter_state(objectPtr);
+        }
+        //Releases the module's hold of its interpreter's state, called once the module is freed.
+        static void release_interpreter_state(PyObject* object)
+        {
+            auto state = static_cast<State*>(PyModule_GetState(object));
+            if(state == nullptr || state->m_interpreter == nullptr)
+                return;
+            InterpreterState::release_module(*state->m_interpreter);
+            state->m_interpreter = nullptr;
         }
         static PyObject* get_module_instance_dict(PyObject* object)
         {
@@ -433,6 +486,64 @@ namespace sweetPy {
         std::vector<EnumPair> m_enums;
         std::string m_name;
         std::string m_doc;
+        std::size_t m_freeListCapacity;
+    };
+    
+    /*
+     * Multi phase (PEP 489) module definition, the interpreter creates the module object and initializer populates it.
+     * Every interpreter importing the module executes the definition into a module, types and context of its own.
+     */
+    class ModuleDefinition
+    {
+    public:
+        typedef void(*Initializer)(Module&);
+        ModuleDefinition(const char* name, const char* doc, Initializer initializer)
+            :m_definition{PyModuleDef_HEAD_INIT}, m_initializer(initializer), m_slots{}
+        {
+            m_slots[0] = {Py_mod_exec, reinterpret_cast<void*>(&exec)};
+            m_definition.m_name = name;
+            m_definition.m_doc = doc;
+            m_definition.m_size = sizeof(Module::State);
+            m_definition.m_slots = m_slots;
+            m_definition.m_clear = &Module::clear_module;
+            m_definition.m_free = &free_module;
+        }
+        ModuleDefinition(const ModuleDefinition&) = delete;
+        ModuleDefinition& operator=(const ModuleDefinition&) = delete;
+        PyObject* init(){ return PyModuleDef_Init(&m_definition); }
+    
+    private:
+        static int exec(PyObject* module)
+        {
+            try
+            {
+                //The definition is the leading member, recovered from the module's definition.
+                auto& self = *reinterpret_cast<ModuleDefinition*>(PyModule_GetDef(module));
+                InterpreterState::acquire();
+                PyThreadState* state = PyThreadState_Get();
+                if(state->interp != PyInterpreterState_Main())
+                    GilState::bind(state);
+                Module instance(module);
+                self.m_initializer(instance);
+                instance.finalize();
+                return 0;
+            }
+            catch(const CPythonException& exc)
+            {
+                exc.raise();
+                return -1;
+            }
+        }
+        static void free_module(void* module)
+        {
+            Module::clear_module(static_cast<PyObject*>(module));
+            Module::release_interpreter_state(static_cast<PyObject*>(module));
+        }
+    
+    private:
+        PyModuleDef m_definition;
+        Initializer m_initializer;
+        PyModuleDef_Slot m_slots[2];
     };
 }
 
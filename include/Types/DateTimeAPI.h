@@ -0,0 +1,18 @@
+#pragma once
+
+#include <Python.h>
+#include <datetime.h>
+#include "../Core/Assert.h"
+
+namespace sweetPy {
+    //datetime.h defines PyDateTimeAPI per translation unit, imported upon the unit's first conversion.
+    //Checked and imported under the GIL, concurrent first imports are serialized by importlib - no lock may be held
+    //across the import, it runs python code which drops the GIL.
+    static inline void import_datetime_api()
+    {
+        if(PyDateTimeAPI != nullptr)
+            return;
+        PyDateTime_IMPORT;
+        CPYTHON_VERIFY(PyDateTimeAPI != nullptr, "datetime C API import failed");
+    }
+}
@@ -2,49 +2,71 @@
 
 #include <Python.h>
 #include <memory>
-#include "core/Assert.h"
+#include <string>
+#include "../Core/Assert.h"
 #include "../Core/Deleter.h"
+#include "ObjectPtr.h"
 #include "Tuple.h"
-#include "List.h"
 #include "Dictionary.h"
-#include "AsciiString.h"
 
 namespace sweetPy{
-    PyCodeObject
+
+    //Code object's description, attributes are read through their python names which remain stable across versions.
     class CodeObject
     {
     public:
         explicit CodeObject(PyObject* object)
+            :m_object(nullptr, &Deleter::Owner)
         {
-            VERIFY(PyCode_Check(object), "Provided instance type is not  of PyCode_Type");
-            PyCodeObject &codeObject = *reinterpret_cast<PyCodeObject *>(object);
-            m_argCount = codeObject.co_argcount;
-            m_kwOnlyArgCount = codeObject.co_kwonlyargcount;
-            m_nLocals = codeObject.co_nlocals;
-            m_stackSize = codeObject.co_stacksize;
-            m_flags = codeObject.co_flags;
-            m_firstLineno = codeObject.co_firstlineno;
-            m_code = Object<std::string>::from_python(codeObject.co_code);
-            m_consts.reset(new List(codeObject.co_consts));
-            m_names.reset(new List(codeObject.co_name));
-            m_varNames.reset(new Tuple(codeObject.co_varnames));
-            m_freeVars.reset(new Tuple(codeObject.co_freevars));
-            m_cellVars.reset(new Tuple(codeObject.co_cellvars));
+            CPYTHON_VERIFY(PyCode_Check(object), "Provided instance type is not of PyCode_Type");
+            Py_INCREF(object);
+            m_object.reset(object);
+            m_argCount = get_int(object, "co_argcount");
+            m_kwOnlyArgCount = get_int(object, "co_kwonlyargcount");
+            m_nLocals = get_int(object, "co_nlocals");
+            m_stackSize = get_int(object, "co_stacksize");
+            m_flags = get_int(object, "co_flags");
+            m_firstLineno = get_int(object, "co_firstlineno");
+            m_code = Object<std::string>::from_python(get_attribute(object, "co_code").get());
+            m_name = Object<std::string>::from_python(get_attribute(object, "co_name").get());
+            m_fileName = Object<std::string>::from_python(get_attribute(object, "co_filename").get());
+            m_names.reset(new Tuple(get_attribute(object, "co_names").get()));
+            m_varNames.reset(new Tuple(get_attribute(object, "co_varnames").get()));
+            m_freeVars.reset(new Tuple(get_attribute(object, "co_freevars").get()));
+            m_cellVars.reset(new Tuple(get_attribute(object, "co_cellvars").get()));
         }
-        
+
         int get_arg_count() const { return m_argCount; }
         int get_kw_only_arg_count() const { return m_kwOnlyArgCount; }
         int get_n_locals() const { return m_nLocals; }
         int get_stack_size() const { return m_stackSize; }
         int get_flags() const { return m_flags; }
+        int get_first_lineno() const { return m_firstLineno; }
         const std::string& get_code() const { return m_code; }
-        const List& get_consts() const { return m_consts; }
-        const List& get_names() const { return m_names; }
-        const Tuple& get_var_names() const { return m_varNames; }
-        const Tuple& get_free_vars() const { return m_freeVars; }
-        const Tuple& get_cell_vars() const { return m_cellVars; }
-        
+        const std::string& get_name() const { return m_name; }
+        const std::string& get_file_name() const { return m_fileName; }
+        //Constants may hold nested code objects, those are kept as python objects.
+        ObjectPtr get_consts() const { return get_attribute(m_object.get(), "co_consts"); }
+        const Tuple& get_names() const { return *m_names; }
+        const Tuple& get_var_names() const { return *m_varNames; }
+        const Tuple& get_free_vars() const { return *m_freeVars; }
+        const Tuple& get_cell_vars() const { return *m_cellVars; }
+        PyObject* get_object() const { return m_object.get(); }
+
+    private:
+        static ObjectPtr get_attribute(PyObject* object, const char* name)
+        {
+            ObjectPtr attribute(PyObject_GetAttrString(object, name), &Deleter::Owner);
+            CPYTHON_VERIFY_EXC(attribute.get() != nullptr);
+            return attribute;
+        }
+        static int get_int(PyObject* object, const char* name)
+        {
+            return static_cast<int>(PyLong_AsLong(get_attribute(object, name).get()));
+        }
+
     private:
+        ObjectPtr m_object;
         int m_argCount;
         int m_kwOnlyArgCount;
         int m_nLocals;
@@ -52,23 +74,20 @@ namespace sweetPy{
         int m_flags;
         int m_firstLineno;
         std::string m_code;
-        typedef std::unique_ptr<List> CountsPtr;
-        CountsPtr m_consts;
-        typedef std::unique_ptr<List> NamesPtr;
+        std::string m_name;
+        std::string m_fileName;
+        typedef std::unique_ptr<Tuple> NamesPtr;
         NamesPtr m_names;
-        typedef std::unique_ptr<Tuple> VarNamesPtr;
-        VarNamesPtr m_varNames;
-        typedef std::unique_ptr<Tuple> FreeVarsPtr;
-        FreeVarsPtr m_freeVars;
-        typedef std::unique_ptr<Tuple> CellVarsPtr;
-        CellVarPtr m_cellVars;
+        NamesPtr m_varNames;
+        NamesPtr m_freeVars;
+        NamesPtr m_cellVars;
     };
-    
-    PyFunctionObject
-    class Function
+
+    //Python function's description, named apart from the native sweetPy::Function binding.
+    class PythonFunction
     {
     public:
-        explicit Function(PyObject* object)
+        explicit PythonFunction(PyObject* object)
         {
             CPYTHON_VERIFY(PyFunction_Check(object), "Received object is not an instance of PyFunction");
             PyFunctionObject& function = *reinterpret_cast<PyFunctionObject*>(object);
@@ -82,10 +101,11 @@ namespace sweetPy{
                 m_kwdefaults.reset(new Dictionary(function.func_kwdefaults));
             if(function.func_closure)
                 m_closure.reset(new Tuple(function.func_closure));
-            m_doc = Object<std::string>::from_python(function.func_doc);
+            if(function.func_doc && function.func_doc != Py_None)
+                m_doc = Object<std::string>::from_python(function.func_doc);
             m_name = Object<std::string>::from_python(function.func_name);
         }
-        
+
         const CodeObject& get_code_object() const { return *m_codeObject; }
         const Dictionary& get_globals() const { return *m_globals; }
         const Tuple& get_defaults() const { return *m_defaults; }
@@ -93,7 +113,7 @@ namespace sweetPy{
         const Tuple& get_closure() const { return *m_closure; }
         const std::string& get_doc() const { return m_doc; }
         const std::string& get_name() const { return m_name; }
-        
+
     private:
         typedef std::unique_ptr<CodeObject> CodeObjectPtr;
         CodeObjectPtr m_codeObject;
@@ -108,4 +128,4 @@ namespace sweetPy{
         std::string m_doc;
         std::string m_name;
     };
-}
\ No newline at end of file
+}
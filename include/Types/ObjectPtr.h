@@ -1,9 +1,99 @@
 #pragma once
 
 #include <Python.h>
-#include <memory>
-#include <functional>
+#include <cstddef>
+#include <utility>
+#include "../Core/Deleter.h"
 
 namespace sweetPy{
-    typedef std::unique_ptr<PyObject, std::function<void(PyObject*)>> ObjectPtr;
+    /*
+     * Two words handle to a python object, the release policy is a plain function pointer.
+     * Deleter::Owner is released by an inline decref, any other policy is invoked as is,
+     * Deleter::GilOwner should be used for handles released by threads which may not hold the GIL.
+     */
+    class ObjectHandle
+    {
+    public:
+        typedef void(*DeleterType)(PyObject*);
+
+        ObjectHandle():m_object(nullptr), m_deleter(&Deleter::Borrow){}
+        ObjectHandle(std::nullptr_t):ObjectHandle(){}
+        ObjectHandle(PyObject* object, DeleterType deleter):m_object(object), m_deleter(deleter){}
+        ~ObjectHandle(){ release_object(); }
+        ObjectHandle(const ObjectHandle&) = delete;
+        ObjectHandle& operator=(const ObjectHandle&) = delete;
+        ObjectHandle(ObjectHandle&& other) noexcept
+            :m_object(other.m_object), m_deleter(other.m_deleter)
+        {
+            other.m_object = nullptr;
+        }
+        ObjectHandle& operator=(ObjectHandle&& other) noexcept
+        {
+            if(this != &other)
+            {
+                release_object();
+                m_object = other.m_object;
+                m_deleter = other.m_deleter;
+                other.m_object = nullptr;
+            }
+            return *this;
+        }
+        ObjectHandle& operator=(std::nullptr_t)
+        {
+            reset();
+            return *this;
+        }
+
+        PyObject* get() const { return m_object; }
+        DeleterType get_deleter() const { return m_deleter; }
+        //Ownership is passed on to the caller.
+        PyObject* release()
+        {
+            PyObject* object = m_object;
+            m_object = nullptr;
+            return object;
+        }
+        //The release policy is kept for the new object.
+        void reset(PyObject* object = nullptr)
+        {
+            PyObject* old = m_object;
+            m_object = object;
+            if(old != nullptr)
+                release_object(old);
+        }
+        void swap(ObjectHandle& other)
+        {
+            std::swap(m_object, other.m_object);
+            std::swap(m_deleter, other.m_deleter);
+        }
+        explicit operator bool() const { return m_object != nullptr; }
+        PyObject* operator->() const { return m_object; }
+        PyObject& operator*() const { return *m_object; }
+
+        friend bool operator==(const ObjectHandle& lhs, std::nullptr_t){ return lhs.m_object == nullptr; }
+        friend bool operator!=(const ObjectHandle& lhs, std::nullptr_t){ return lhs.m_object != nullptr; }
+        friend bool operator==(const ObjectHandle& lhs, const ObjectHandle& rhs){ return lhs.m_object == rhs.m_object; }
+        friend bool operator!=(const ObjectHandle& lhs, const ObjectHandle& rhs){ return lhs.m_object != rhs.m_object; }
+
+    private:
+        void release_object()
+        {
+            if(m_object != nullptr)
+                release_object(m_object);
+        }
+        void release_object(PyObject* object)
+        {
+            if(m_deleter == &Deleter::Owner)
+                Py_DECREF(object);
+            else if(m_deleter != &Deleter::Borrow)
+                m_deleter(object);
+        }
+
+    private:
+        PyObject* m_object;
+        DeleterType m_deleter;
+    };
+
+    //Compatibility alias, ObjectPtr used to be a unique_ptr with a std::function deleter.
+    typedef ObjectHandle ObjectPtr;
 }
@@ -6,6 +6,7 @@
 #include "../Detail/CPythonObject.h"
 #include "../Core/Assert.h"
 #include "ObjectPtr.h"
+#include "DateTimeAPI.h"
 
 namespace sweetPy {
 
@@ -59,8 +60,7 @@ public:
     }
     static inline __attribute__((always_inline)) void ImportDateTimeModule()
     {
-        if(PyDateTimeAPI == nullptr) //No need to use fences thanks to GIL
-            PyDateTime_IMPORT;
+        import_datetime_api();
     }
     
 private:
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Python.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include "../Types/ObjectPtr.h"
+
+namespace sweetPy
+{
+    /*
+     * On disk cache of compiled code objects, sparing an embedding host the compilation of its scripts upon every
+     * start. Code objects are stored marshalled, keyed by their source, file name and start symbol, and are tagged
+     * by the interpreter's bytecode magic number and the optimization level - entries of other python versions or
+     * levels are never loaded. Entries hold their key, a hash collision is compared out and recompiled.
+     * Entries are written through a temporary file and renamed, processes may share a cache directory.
+     */
+    class CodeCache
+    {
+    public:
+        //The directory is created if missing, code is compiled at the given optimization level, as compile()'s optimize.
+        explicit CodeCache(const std::string& directory, int optimize = 0);
+
+        //source's compiled code, loaded from the cache if present, compiled and stored otherwise.
+        ObjectPtr compile(const std::string& source, const std::string& fileName, int start = Py_file_input);
+        std::size_t get_hits() const { return m_hits; }
+        std::size_t get_misses() const { return m_misses; }
+        const std::string& get_directory() const { return m_directory; }
+
+    private:
+        struct Header
+        {
+            std::uint32_t m_magic;
+            std::uint32_t m_pythonMagic;
+            std::uint32_t m_marshalVersion;
+            std::int32_t m_optimize;
+            std::uint64_t m_keyHash;
+            std::uint64_t m_keySize;
+        };
+        //The entry's identity, stored following the header and compared upon load.
+        static std::string create_key(const std::string& source, const std::string& fileName, int start);
+        static std::uint64_t hash(const std::string& key);
+        Header create_header(const std::string& key, std::uint64_t keyHash) const;
+        std::string get_path(std::uint64_t keyHash) const;
+        ObjectPtr load(const std::string& path, const Header& expected, const std::string& key) const;
+        void store(const std::string& path, const Header& header, const std::string& key, PyObject* code) const;
+
+    private:
+        static const std::uint32_t MAGIC_WORD = 0x43435053;
+        std::string m_directory;
+        int m_optimize;
+        std::uint32_t m_pythonMagic;
+        std::size_t m_hits;
+        std::size_t m_misses;
+    };
+}
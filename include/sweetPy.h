@@ -8,4 +8,6 @@
 #include "Clazz.h"
 #include "Module.h"
 #include "InitModule.h"
-#include "Enum.h"
\ No newline at end of file
+#include "Enum.h"
+#include "Core/InterpreterPool.h"
+#include "Core/Interpreter.h"
\ No newline at end of file
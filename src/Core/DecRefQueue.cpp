@@ -0,0 +1,87 @@
+#include <algorithm>
+#include "Core/DecRefQueue.h"
+
+namespace sweetPy{
+
+    DecRefQueue::DecRefQueue()
+        :m_head(nullptr), m_scheduled(false), m_depth(0), m_maxDepth(0), m_enqueued(0), m_drained(0), m_batches(0),
+         m_lastLatency(0), m_maxLatency(0)
+    {
+    }
+
+    DecRefQueue::~DecRefQueue()
+    {
+        //The interpreter may already be finalized, pending objects are leaked.
+        Node* node = m_head.exchange(nullptr);
+        while(node != nullptr)
+        {
+            Node* next = node->m_next;
+            delete node;
+            node = next;
+        }
+    }
+
+    void DecRefQueue::push(PyObject* object)
+    {
+        if(object == nullptr || Py_IsInitialized() == 0)
+            return;
+
+        Node* node = new Node{object, m_head.load(std::memory_order_relaxed), std::chrono::steady_clock::now()};
+        while(m_head.compare_exchange_weak(node->m_next, node, std::memory_order_release, std::memory_order_relaxed) == false);
+
+        std::size_t depth = m_depth.fetch_add(1, std::memory_order_relaxed) + 1;
+        std::size_t maxDepth = m_maxDepth.load(std::memory_order_relaxed);
+        while(depth > maxDepth && m_maxDepth.compare_exchange_weak(maxDepth, depth, std::memory_order_relaxed) == false);
+        m_enqueued.fetch_add(1, std::memory_order_relaxed);
+        schedule();
+    }
+
+    void DecRefQueue::schedule()
+    {
+        if(m_scheduled.exchange(true, std::memory_order_acq_rel))
+            return;
+        //The pending calls queue may be full, the next push will try again.
+        if(Py_AddPendingCall(&DecRefQueue::drain_pending, this) != 0)
+            m_scheduled.store(false, std::memory_order_release);
+    }
+
+    int DecRefQueue::drain_pending(void* queue)
+    {
+        auto& self = *static_cast<DecRefQueue*>(queue);
+        //Cleared ahead of the drain, releases pushed afterwards schedule a new pending call.
+        self.m_scheduled.store(false, std::memory_order_release);
+        self.drain();
+        return 0;
+    }
+
+    std::size_t DecRefQueue::drain()
+    {
+        Node* node = m_head.exchange(nullptr, std::memory_order_acquire);
+        if(node == nullptr)
+            return 0;
+
+        auto now = std::chrono::steady_clock::now();
+        auto oldest = now;
+        for(Node* current = node; current != nullptr; current = current->m_next)
+            oldest = std::min(oldest, current->m_enqueued);
+        Duration::rep latency = std::chrono::duration_cast<Duration>(now - oldest).count();
+        m_lastLatency.store(latency, std::memory_order_relaxed);
+        Duration::rep maxLatency = m_maxLatency.load(std::memory_order_relaxed);
+        while(latency > maxLatency && m_maxLatency.compare_exchange_weak(maxLatency, latency, std::memory_order_relaxed) == false);
+
+        //A decref may run arbitrary code, a nested drain takes on a batch of its own.
+        std::size_t count = 0;
+        while(node != nullptr)
+        {
+            Node* next = node->m_next;
+            Py_DECREF(node->m_object);
+            delete node;
+            node = next;
+            count++;
+        }
+        m_depth.fetch_sub(count, std::memory_order_relaxed);
+        m_drained.fetch_add(count, std::memory_order_relaxed);
+        m_batches.fetch_add(1, std::memory_order_relaxed);
+        return count;
+    }
+}
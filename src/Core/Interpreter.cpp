@@ -0,0 +1,132 @@
+#include "Core/Interpreter.h"
+
+#if PY_VERSION_HEX >= 0x03080000
+#include "Types/ObjectPtr.h"
+#include "Core/Assert.h"
+#include "Core/Deleter.h"
+
+namespace sweetPy{
+
+    typedef std::chrono::steady_clock Clock;
+
+    Interpreter::Interpreter()
+        :m_isolated(false), m_siteImport(true), m_searchPathsSet(false), m_initialized(false), m_timings{}
+    {
+    }
+
+    Interpreter::~Interpreter()
+    {
+        finalize();
+    }
+
+    void Interpreter::verify_status(const PyStatus& status)
+    {
+        if(PyStatus_Exception(status))
+            throw CPythonException(PyExc_RuntimeError, __CORE_SOURCE, "Interpreter initialization failed - %s: %s",
+                                   status.func != nullptr ? status.func : "", status.err_msg != nullptr ? status.err_msg : "exit requested");
+    }
+
+    void Interpreter::initialize()
+    {
+        CPYTHON_VERIFY(Py_IsInitialized() == 0, "An interpreter was already initialized");
+        m_timings = Timings{};
+        Clock::time_point start = Clock::now();
+        PyPreConfig preConfig;
+        if(m_isolated)
+            PyPreConfig_InitIsolatedConfig(&preConfig);
+        else
+            PyPreConfig_InitPythonConfig(&preConfig);
+        verify_status(Py_PreInitialize(&preConfig));
+        Clock::time_point preInitialized = Clock::now();
+
+        //The inittab is allocated by the memory allocator the pre initialization sets.
+        for(auto& module : m_modules)
+            CPYTHON_VERIFY(PyImport_AppendInittab(module.first.c_str(), module.second) == 0, "Module registration failed");
+        PyConfig config;
+        if(m_isolated)
+            PyConfig_InitIsolatedConfig(&config);
+        else
+            PyConfig_InitPythonConfig(&config);
+        Clock::time_point configured;
+        try
+        {
+            configure(config);
+            configured = Clock::now();
+            verify_status(Py_InitializeFromConfig(&config));
+        }
+        catch(...)
+        {
+            PyConfig_Clear(&config);
+            throw;
+        }
+        PyConfig_Clear(&config);
+        m_initialized = true;
+        Clock::time_point initialized = Clock::now();
+
+        import_modules();
+        m_timings.m_preInitialization = std::chrono::duration_cast<Duration>(preInitialized - start);
+        m_timings.m_configuration = std::chrono::duration_cast<Duration>(configured - preInitialized);
+        m_timings.m_initialization = std::chrono::duration_cast<Duration>(initialized - configured);
+        m_timings.m_imports = std::chrono::duration_cast<Duration>(Clock::now() - initialized);
+    }
+
+    void Interpreter::configure(PyConfig& config)
+    {
+        config.site_import = m_siteImport ? 1 : 0;
+        config.parse_argv = 0;
+        if(m_programName.empty() == false)
+            verify_status(PyConfig_SetBytesString(&config, &config.program_name, m_programName.c_str()));
+        if(m_arguments.empty() == false)
+        {
+            std::vector<char*> arguments;
+            for(auto& argument : m_arguments)
+                arguments.emplace_back(const_cast<char*>(argument.c_str()));
+            verify_status(PyConfig_SetBytesArgv(&config, static_cast<Py_ssize_t>(arguments.size()), arguments.data()));
+        }
+        if(m_searchPathsSet)
+        {
+            //A set sys.path skips its calculation, which probes the file system for the standard library.
+            config.module_search_paths_set = 1;
+            for(auto& searchPath : m_searchPaths)
+            {
+                wchar_t* path = Py_DecodeLocale(searchPath.c_str(), nullptr);
+                CPYTHON_VERIFY(path != nullptr, "Search path decoding failed");
+                PyStatus status = PyWideStringList_Append(&config.module_search_paths, path);
+                PyMem_RawFree(path);
+                verify_status(status);
+            }
+        }
+    }
+
+    void Interpreter::import_modules()
+    {
+        if(m_addedSearchPaths.empty() == false)
+        {
+            PyObject* path = PySys_GetObject("path");
+            CPYTHON_VERIFY(path != nullptr && PyList_Check(path), "sys.path is missing");
+            Py_ssize_t index = 0;
+            for(auto& searchPath : m_addedSearchPaths)
+            {
+                ObjectPtr entry(PyUnicode_DecodeFSDefault(searchPath.c_str()), &Deleter::Owner);
+                CPYTHON_VERIFY_EXC(entry.get() != nullptr);
+                CPYTHON_VERIFY(PyList_Insert(path, index++, entry.get()) == 0, "sys.path update failed");
+            }
+        }
+        for(auto& name : m_imports)
+        {
+            ObjectPtr module(PyImport_ImportModule(name.c_str()), &Deleter::Owner);
+            if(module.get() == nullptr)
+                throw CPythonException(PyExc_ImportError, __CORE_SOURCE, "Importing %s failed - %s", name.c_str(),
+                                       CPythonException::fetch_pending_error().c_str());
+        }
+    }
+
+    void Interpreter::finalize()
+    {
+        if(m_initialized == false)
+            return;
+        m_initialized = false;
+        Py_FinalizeEx();
+    }
+}
+#endif
@@ -0,0 +1,126 @@
+#include <algorithm>
+#include "Core/Assert.h"
+#include "Core/InterpreterPool.h"
+
+namespace sweetPy{
+
+    InterpreterPool::InterpreterPool(std::size_t interpretersCount, const std::string& bootstrap)
+        :m_started(0), m_bootstrap(bootstrap), m_stop(false)
+    {
+        interpretersCount = std::max<std::size_t>(1, interpretersCount);
+        for(std::size_t index = 0; index < interpretersCount; index++)
+            m_workers.emplace_back(&InterpreterPool::run_interpreter, this);
+
+        std::exception_ptr error;
+        {
+            //Interpreters are created while holding the main interpreter's GIL.
+            GilRelease release;
+            std::unique_lock<std::mutex> guard(m_lock);
+            m_condition.wait(guard, [this]{ return m_started == m_workers.size(); });
+            error = m_startError;
+        }
+        if(error)
+        {
+            stop();
+            std::rethrow_exception(error);
+        }
+    }
+
+    InterpreterPool::~InterpreterPool()
+    {
+        stop();
+    }
+
+    void InterpreterPool::push(Task&& task)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_tasks.emplace_back(std::move(task));
+        }
+        m_condition.notify_one();
+    }
+
+    void InterpreterPool::stop()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        GilRelease release;
+        for(auto& worker : m_workers)
+            if(worker.joinable())
+                worker.join();
+    }
+
+    void InterpreterPool::run_interpreter()
+    {
+        PyGILState_STATE mainState = PyGILState_Ensure();
+        PyThreadState* main = PyThreadState_Get();
+        PyThreadState* state = nullptr;
+        std::exception_ptr error;
+        try
+        {
+            state = Py_NewInterpreter();
+            CPYTHON_VERIFY(state != nullptr, "Sub interpreter creation failed");
+            GilState::bind(state);
+            if(m_bootstrap.empty() == false)
+                execute(m_bootstrap, Py_file_input);
+        }
+        catch(...)
+        {
+            error = std::current_exception();
+        }
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            if(error && !m_startError)
+                m_startError = error;
+            m_started++;
+        }
+        m_condition.notify_all();
+
+        if(state != nullptr)
+        {
+            if(!error)
+                serve(state);
+            Py_EndInterpreter(state);
+            GilState::bind(nullptr);
+            PyThreadState_Swap(main);
+        }
+        PyGILState_Release(mainState);
+    }
+
+    void InterpreterPool::serve(PyThreadState* state)
+    {
+        PyEval_SaveThread();
+        while(true)
+        {
+            Task task;
+            {
+                std::unique_lock<std::mutex> guard(m_lock);
+                m_condition.wait(guard, [this]{ return m_tasks.empty() == false || m_stop; });
+                //Pending tasks are completed ahead of stopping.
+                if(m_tasks.empty())
+                    break;
+                task = std::move(m_tasks.front());
+                m_tasks.pop_front();
+            }
+            PyEval_RestoreThread(state);
+            task();
+            PyErr_Clear();
+            PyEval_SaveThread();
+        }
+        PyEval_RestoreThread(state);
+    }
+
+    ObjectPtr InterpreterPool::execute(const std::string& source, int start)
+    {
+        PyObject* mainModule = PyImport_AddModule("__main__");
+        CPYTHON_VERIFY(mainModule != nullptr, "__main__ module is missing");
+        PyObject* globals = PyModule_GetDict(mainModule);
+        ObjectPtr result(PyRun_String(source.c_str(), start, globals, globals), &Deleter::Owner);
+        if(result.get() == nullptr)
+            throw CPythonException(PyExc_RuntimeError, __CORE_SOURCE, "%s", CPythonException::fetch_pending_error().c_str());
+        return result;
+    }
+}
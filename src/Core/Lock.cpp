@@ -1,5 +0,0 @@
-#include "Core/Lock.h"
-
-namespace sweetPy{
-    thread_local bool GilRelease::m_alreadyReleased = false;
-}
\ No newline at end of file
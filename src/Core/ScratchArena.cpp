@@ -0,0 +1,37 @@
+#include <algorithm>
+#include <new>
+#include "Core/ScratchArena.h"
+
+namespace sweetPy{
+
+    ScratchArena::~ScratchArena()
+    {
+        for(auto& chunk : m_chunks)
+            ::operator delete(chunk.m_data);
+    }
+
+    std::size_t ScratchArena::get_capacity() const
+    {
+        std::size_t capacity = 0;
+        for(auto& chunk : m_chunks)
+            capacity += chunk.m_size;
+        return capacity;
+    }
+
+    void* ScratchArena::allocate_chunk(std::size_t bytes, std::size_t alignment)
+    {
+        std::size_t required = bytes + alignment;
+        //Chunks retained from previous calls are reused ahead of allocating a new one.
+        std::size_t next = m_chunks.empty() ? 0 : m_current + 1;
+        while(next < m_chunks.size() && m_chunks[next].m_size < required)
+            next++;
+        if(next == m_chunks.size())
+        {
+            std::size_t size = std::max(required, m_chunks.empty() ? InitialChunkSize : m_chunks.back().m_size * 2);
+            m_chunks.push_back(Chunk{static_cast<char*>(::operator new(size)), size});
+        }
+        m_current = next;
+        m_offset = 0;
+        return do_allocate(bytes, alignment);
+    }
+}
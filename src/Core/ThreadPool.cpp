@@ -0,0 +1,151 @@
+#include <algorithm>
+#include "Core/ThreadPool.h"
+
+namespace sweetPy{
+
+    ThreadPool::ThreadPool(std::size_t workersCount)
+        :m_pending(0), m_stop(false), m_nextQueue(0)
+    {
+        workersCount = std::max<std::size_t>(1, workersCount);
+        for(std::size_t index = 0; index < workersCount; index++)
+            m_queues.emplace_back(new WorkerQueue());
+        for(std::size_t index = 0; index < workersCount; index++)
+            m_workers.emplace_back(&ThreadPool::run, this, index);
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_stop = true;
+        }
+        m_condition.notify_all();
+        for(auto& worker : m_workers)
+            worker.join();
+    }
+
+    ThreadPool& ThreadPool::instance()
+    {
+        static ThreadPool pool(std::thread::hardware_concurrency());
+        return pool;
+    }
+
+    void ThreadPool::submit(Task&& task)
+    {
+        WorkerQueue& queue = *m_queues[m_nextQueue++ % m_queues.size()];
+        {
+            std::lock_guard<std::mutex> guard(queue.m_lock);
+            queue.m_tasks.emplace_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_pending++;
+        }
+        m_condition.notify_one();
+    }
+
+    bool ThreadPool::pop(std::size_t index, Task& task)
+    {
+        WorkerQueue& queue = *m_queues[index];
+        std::lock_guard<std::mutex> guard(queue.m_lock);
+        if(queue.m_tasks.empty())
+            return false;
+        task = std::move(queue.m_tasks.back());
+        queue.m_tasks.pop_back();
+        return true;
+    }
+
+    bool ThreadPool::steal(std::size_t index, Task& task)
+    {
+        for(std::size_t offset = 1; offset < m_queues.size(); offset++)
+        {
+            WorkerQueue& queue = *m_queues[(index + offset) % m_queues.size()];
+            std::lock_guard<std::mutex> guard(queue.m_lock);
+            if(queue.m_tasks.empty())
+                continue;
+            task = std::move(queue.m_tasks.front());
+            queue.m_tasks.pop_front();
+            return true;
+        }
+        return false;
+    }
+
+    void ThreadPool::run(std::size_t index)
+    {
+        while(true)
+        {
+            {
+                std::unique_lock<std::mutex> guard(m_lock);
+                m_condition.wait(guard, [this]{ return m_pending > 0 || m_stop; });
+                if(m_pending == 0 && m_stop)
+                    return;
+            }
+            Task task;
+            if(pop(index, task) || steal(index, task))
+            {
+                {
+                    std::lock_guard<std::mutex> guard(m_lock);
+                    m_pending--;
+                }
+                task();
+            }
+            else
+                std::this_thread::yield(); //Another worker took the task between the wake up and the queues scan.
+        }
+    }
+
+    void ThreadPool::parallel_for(std::size_t count, std::size_t concurrency, const Body& body)
+    {
+        if(count == 0)
+            return;
+
+        //Shared with the pool tasks, which may start only after the invocation already completed.
+        struct State
+        {
+            std::atomic<std::size_t> m_next{0};
+            std::atomic<bool> m_failed{false};
+            std::size_t m_done = 0;
+            std::exception_ptr m_exception;
+            std::mutex m_lock;
+            std::condition_variable m_condition;
+        };
+        auto state = std::make_shared<State>();
+        concurrency = std::max<std::size_t>(1, std::min(concurrency, count));
+        std::size_t chunkSize = std::max<std::size_t>(1, count / (concurrency * 8));
+
+        auto process = [state, count, chunkSize, &body]{
+            std::size_t begin;
+            while((begin = state->m_next.fetch_add(chunkSize)) < count)
+            {
+                std::size_t end = std::min(count, begin + chunkSize);
+                if(state->m_failed == false)
+                {
+                    try
+                    {
+                        for(std::size_t index = begin; index < end; index++)
+                            body(index);
+                    }
+                    catch(...)
+                    {
+                        std::lock_guard<std::mutex> guard(state->m_lock);
+                        if(state->m_failed.exchange(true) == false)
+                            state->m_exception = std::current_exception();
+                    }
+                }
+                std::lock_guard<std::mutex> guard(state->m_lock);
+                state->m_done += end - begin;
+                if(state->m_done == count)
+                    state->m_condition.notify_all();
+            }
+        };
+
+        for(std::size_t task = 1; task < concurrency; task++)
+            submit(process);
+        process();
+
+        std::unique_lock<std::mutex> guard(state->m_lock);
+        state->m_condition.wait(guard, [&state, count]{ return state->m_done == count; });
+        if(state->m_exception)
+            std::rethrow_exception(state->m_exception);
+    }
+}
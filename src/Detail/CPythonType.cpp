@@ -1,8 +1,49 @@
+#include <cstring>
 #include "Detail/CPythonType.h"
+#include "Detail/TypesContainer.h"
 
 namespace sweetPy {
 
     PyGC_Head CPythonType::m_nextStub{};
     PyGC_Head CPythonType::m_prevStub{};
     PyMemberDef CPythonType::MembersDefs::m_sentinal = {NULL};
+
+    void CPythonType::unregister()
+    {
+        CPythonType* self = this;
+        if(m_slot != nullptr)
+            m_slot->compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+        if(m_container != nullptr)
+            m_container->remove_type(m_hash_code, *this);
+    }
+
+    void CPythonType::unbind()
+    {
+        CPythonType* self = this;
+        if(m_slot != nullptr)
+            m_slot->compare_exchange_strong(self, nullptr, std::memory_order_acq_rel);
+        m_slot = nullptr;
+        m_container = nullptr;
+    }
+
+    //Mirrors PyType_GenericAlloc for the fixed size, non collectable, sweetPy types.
+    PyObject* CPythonType::alloc_instance(PyTypeObject* type, Py_ssize_t nitems)
+    {
+        CPythonType& cpythonType = *get_type(reinterpret_cast<PyObject*>(type));
+        void* block = cpythonType.m_freeList.allocate(type->tp_basicsize);
+        if(block == nullptr)
+            return PyErr_NoMemory();
+        std::memset(block, 0, type->tp_basicsize);
+#if PY_VERSION_HEX < 0x03080000
+        if(type->tp_flags & Py_TPFLAGS_HEAPTYPE)
+            Py_INCREF(type);
+#endif
+        return PyObject_INIT(reinterpret_cast<PyObject*>(block), type);
+    }
+
+    void CPythonType::free_instance(void* object)
+    {
+        PyTypeObject* type = Py_TYPE(reinterpret_cast<PyObject*>(object));
+        get_type(reinterpret_cast<PyObject*>(type))->m_freeList.release(object);
+    }
 }
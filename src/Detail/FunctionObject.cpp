@@ -0,0 +1,178 @@
+#include <Python.h>
+#include <cstddef>
+#include <structmember.h>
+#include "core/Source.h"
+#include "Core/Deleter.h"
+#include "Core/SPException.h"
+#include "Core/Assert.h"
+#include "Detail/FunctionObject.h"
+#include "Detail/InterpreterState.h"
+
+namespace sweetPy {
+
+    PyTypeObject& FunctionObject::get_type()
+    {
+        return InterpreterState::get().get_function_type();
+    }
+
+    PyTypeObject FunctionObject::create_type()
+    {
+        static PyMemberDef members[] = {
+            {const_cast<char*>("__name__"), T_OBJECT, offsetof(CallableObject, m_name), READONLY, nullptr},
+            {const_cast<char*>("__doc__"), T_OBJECT, offsetof(CallableObject, m_doc), READONLY, nullptr},
+            {const_cast<char*>("__self__"), T_OBJECT, offsetof(CallableObject, m_instance), READONLY, nullptr},
+            {nullptr}
+        };
+        static PyMethodDef methods[] = {
+            {"map", &map, METH_O, "map(iterable) -> list, applies the function over each element of iterable, "
+                                  "elements are unpacked for functions of several arguments."},
+            {nullptr}
+        };
+        PyTypeObject type = {PyVarObject_HEAD_INIT(&PyType_Type, 0)};
+        type.tp_name = "sweetPy.function";
+        type.tp_basicsize = sizeof(CallableObject);
+        type.tp_dealloc = &dealloc;
+        type.tp_traverse = &traverse;
+        type.tp_clear = &clear;
+        type.tp_repr = &repr;
+        type.tp_call = &call;
+        type.tp_getattro = PyObject_GenericGetAttr;
+        type.tp_members = members;
+        type.tp_methods = methods;
+        type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC;
+#ifdef SWEETPY_VECTORCALL_SUPPORT
+        type.tp_flags |= SWEETPY_TPFLAGS_HAVE_VECTORCALL;
+        type.tp_vectorcall_offset = offsetof(CallableObject, m_vectorcall);
+#endif
+        return type;
+    }
+
+    ObjectPtr FunctionObject::create(Function& function, PyObject* instance)
+    {
+        CallableObject* callable = PyObject_GC_New(CallableObject, &get_type());
+        CPYTHON_VERIFY(callable != nullptr, "Function object allocation failed");
+#ifdef SWEETPY_VECTORCALL_SUPPORT
+        callable->m_vectorcall = &vectorcall;
+#endif
+        callable->m_function = &function; //Owned by the module or type context.
+        Py_XINCREF(instance);
+        callable->m_instance = instance;
+        callable->m_bound = instance != nullptr;
+        callable->m_name = PyUnicode_InternFromString(function.get_name().c_str());
+        callable->m_doc = PyUnicode_FromString(function.get_doc().c_str());
+        PyObject_GC_Track(callable);
+        return ObjectPtr(reinterpret_cast<PyObject*>(callable), &Deleter::Owner);
+    }
+
+#ifdef SWEETPY_VECTORCALL_SUPPORT
+    PyObject* FunctionObject::vectorcall(PyObject* callable, PyObject* const* args, size_t nargsf, PyObject* kwnames)
+    {
+        auto& object = *reinterpret_cast<CallableObject*>(callable);
+        if(!verify_bound(object))
+            return NULL;
+        if(kwnames != nullptr && PyTuple_GET_SIZE(kwnames) != 0)
+        {
+            CPythonException(PyExc_TypeError, __CORE_SOURCE, "%s() takes no keyword arguments",
+                             object.m_function->get_name().c_str()).raise();
+            return NULL;
+        }
+        return object.m_function->call(object.m_instance, args, PyVectorcall_NARGS(nargsf));
+    }
+#endif
+
+    PyObject* FunctionObject::call(PyObject* callable, PyObject* args, PyObject* kwargs)
+    {
+        auto& object = *reinterpret_cast<CallableObject*>(callable);
+        if(!verify_bound(object))
+            return NULL;
+        if(kwargs != nullptr && PyDict_GET_SIZE(kwargs) != 0)
+        {
+            CPythonException(PyExc_TypeError, __CORE_SOURCE, "%s() takes no keyword arguments",
+                             object.m_function->get_name().c_str()).raise();
+            return NULL;
+        }
+        return object.m_function->call(object.m_instance, &PyTuple_GET_ITEM(args, 0), PyTuple_GET_SIZE(args));
+    }
+
+    PyObject* FunctionObject::map(PyObject* self, PyObject* iterable)
+    {
+        auto& object = *reinterpret_cast<CallableObject*>(self);
+        if(!verify_bound(object))
+            return NULL;
+        return object.m_function->map(object.m_instance, iterable);
+    }
+
+    PyMethodDef& FunctionObject::get_parallel_map_def()
+    {
+        static PyMethodDef parallelMap = {"parallel_map", (PyCFunction)(void(*)(void))&parallel_map, METH_VARARGS | METH_KEYWORDS,
+                                          "parallel_map(function, iterable, threads=0) -> list, applies a sweetPy function over each "
+                                          "element of iterable on up to threads native threads (0 - all available), the GIL "
+                                          "is released while the native function runs. Functions taking or returning python "
+                                          "objects and non const member functions are rejected."};
+        return parallelMap;
+    }
+
+    PyObject* FunctionObject::parallel_map(PyObject* module, PyObject* args, PyObject* kwargs)
+    {
+        static const char* keywords[] = {"function", "iterable", "threads", nullptr};
+        PyObject* function = nullptr;
+        PyObject* iterable = nullptr;
+        Py_ssize_t threads = 0;
+        if(!PyArg_ParseTupleAndKeywords(args, kwargs, "OO|n:parallel_map", const_cast<char**>(keywords), &function, &iterable, &threads))
+            return NULL;
+        if(!PyObject_TypeCheck(function, &get_type()) || threads < 0)
+        {
+            CPythonException(PyExc_TypeError, __CORE_SOURCE, "parallel_map expects a sweetPy function and a non negative threads count").raise();
+            return NULL;
+        }
+        auto& object = *reinterpret_cast<CallableObject*>(function);
+        if(!verify_bound(object))
+            return NULL;
+        return object.m_function->parallel_map(object.m_instance, iterable, threads);
+    }
+
+    bool FunctionObject::verify_bound(CallableObject& object)
+    {
+        //A bound method whose instance was cleared by the garbage collector, as part of a collected cycle.
+        if(object.m_bound && object.m_instance == nullptr)
+        {
+            CPythonException(PyExc_ReferenceError, __CORE_SOURCE, "%s() bound instance no longer exists",
+                             object.m_function->get_name().c_str()).raise();
+            return false;
+        }
+        return true;
+    }
+
+    PyObject* FunctionObject::repr(PyObject* self)
+    {
+        auto& object = *reinterpret_cast<CallableObject*>(self);
+        if(object.m_instance == nullptr)
+            return PyUnicode_FromFormat("<sweetPy function %U>", object.m_name);
+        return PyUnicode_FromFormat("<sweetPy bound method %U of %s object>", object.m_name, object.m_instance->ob_type->tp_name);
+    }
+
+    int FunctionObject::traverse(PyObject* self, visitproc visit, void* arg)
+    {
+        auto& object = *reinterpret_cast<CallableObject*>(self);
+        Py_VISIT(object.m_instance);
+        return 0;
+    }
+
+    int FunctionObject::clear(PyObject* self)
+    {
+        auto& object = *reinterpret_cast<CallableObject*>(self);
+        Py_CLEAR(object.m_instance);
+        return 0;
+    }
+
+    void FunctionObject::dealloc(PyObject* self)
+    {
+        //The function itself may already be released by its owning context.
+        PyObject_GC_UnTrack(self);
+        auto& object = *reinterpret_cast<CallableObject*>(self);
+        Py_XDECREF(object.m_instance);
+        Py_XDECREF(object.m_name);
+        Py_XDECREF(object.m_doc);
+        PyObject_GC_Del(self);
+    }
+}
@@ -0,0 +1,114 @@
+#include "Core/Assert.h"
+#include "Core/Lock.h"
+#include "Detail/InterpreterState.h"
+#include "Detail/FunctionObject.h"
+#include "Detail/MethodDescriptor.h"
+
+namespace sweetPy {
+
+    namespace {
+        //Detaches a type readied by a finishing interpreter from the python objects that interpreter created.
+        void release_type(PyTypeObject& type)
+        {
+            PyType_Modified(&type);
+            //The base's subclasses refer to the type weakly, references are cleared as for a deallocated type.
+            if(type.tp_weaklist != nullptr)
+            {
+                Py_ssize_t refCount = type.ob_base.ob_base.ob_refcnt;
+                type.ob_base.ob_base.ob_refcnt = 0;
+                PyObject_ClearWeakRefs(reinterpret_cast<PyObject*>(&type));
+                type.ob_base.ob_base.ob_refcnt = refCount;
+            }
+            Py_CLEAR(type.tp_dict);
+            Py_CLEAR(type.tp_mro);
+            Py_CLEAR(type.tp_bases);
+        }
+    }
+
+    std::mutex InterpreterState::m_lock;
+    InterpreterState::States InterpreterState::m_states;
+    std::atomic<InterpreterState*> InterpreterState::m_first{nullptr};
+    std::atomic<bool> InterpreterState::m_multiple{false};
+    std::atomic<std::uint64_t> InterpreterState::m_generation{0};
+
+    InterpreterState::InterpreterState(std::int64_t id)
+        :m_id(id), m_modules(0), m_commonMetaType("common_meta_type", ""), m_functionType(FunctionObject::create_type()),
+         m_methodDescriptorType(MethodDescriptor::create_type())
+    {
+        m_commonMetaType.finalize();
+        CPYTHON_VERIFY(PyType_Ready(&m_functionType) == 0, "Function object type initialization failed");
+        CPYTHON_VERIFY(PyType_Ready(&m_methodDescriptorType) == 0, "Method descriptor type initialization failed");
+    }
+
+    InterpreterState& InterpreterState::acquire()
+    {
+        //Released states invalidate the cached state of every thread, a released state's address may be reused.
+        static thread_local InterpreterState* cached = nullptr;
+        static thread_local std::uint64_t cachedGeneration = 0;
+        std::int64_t id = get_current_id();
+        std::uint64_t generation = m_generation.load(std::memory_order_acquire);
+        if(cached != nullptr && cachedGeneration == generation && cached->m_id == id)
+            return *cached;
+
+        std::lock_guard<std::mutex> guard(m_lock);
+        auto it = m_states.find(id);
+        if(it == m_states.end())
+        {
+            it = m_states.emplace(id, std::unique_ptr<InterpreterState>(new InterpreterState(id))).first;
+            if(m_first.load(std::memory_order_relaxed) == nullptr)
+                m_first.store(it->second.get(), std::memory_order_release);
+            else
+                m_multiple.store(true, std::memory_order_release);
+        }
+        cached = it->second.get();
+        cachedGeneration = generation;
+        return *cached;
+    }
+
+    void InterpreterState::add_module()
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        m_modules++;
+    }
+
+    void InterpreterState::release_module(InterpreterState& state)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            if(--state.m_modules != 0)
+                return;
+        }
+        //Types are released while the state is still resolvable, their objects' deallocation may require it.
+        release_type(*reinterpret_cast<PyTypeObject*>(CPythonType::get_py_object(&state.m_commonMetaType)));
+        release_type(state.m_functionType);
+        release_type(state.m_methodDescriptorType);
+        //The interpreter is finishing, its state may not be recognized as the thread's own anymore.
+        if(GilState::m_bound != nullptr && GilState::m_bound->interp == PyThreadState_Get()->interp)
+            GilState::bind(nullptr);
+
+        //The state is destroyed once the lock is released.
+        std::unique_ptr<InterpreterState> released;
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            auto it = m_states.find(state.m_id);
+            if(state.m_modules != 0 || it == m_states.end())
+                return;
+            released = std::move(it->second);
+            m_states.erase(it);
+            InterpreterState* first = &state;
+            m_first.compare_exchange_strong(first, nullptr, std::memory_order_acq_rel);
+            m_generation.fetch_add(1, std::memory_order_acq_rel);
+        }
+    }
+
+    std::size_t InterpreterState::get_count()
+    {
+        std::lock_guard<std::mutex> guard(m_lock);
+        return m_states.size();
+    }
+
+    TypesContainer& TypesContainer::instance()
+    {
+        return InterpreterState::get().get_types();
+    }
+}
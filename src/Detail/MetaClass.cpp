@@ -1,8 +1,11 @@
 #include "Detail/MetaClass.h"
+#include "Detail/InterpreterState.h"
 
 namespace sweetPy {
     
-    MetaClass MetaClass::m_commonMetaType("common_meta_type", "");
-    MetaClass* commonMetaTypePtr = &MetaClass::get_common_meta_type();
+    MetaClass& MetaClass::get_common_meta_type()
+    {
+        return InterpreterState::get().get_common_meta_type();
+    }
 }
 
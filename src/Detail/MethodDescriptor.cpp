@@ -0,0 +1,138 @@
+#include <Python.h>
+#include <cstddef>
+#include <structmember.h>
+#include "core/Source.h"
+#include "Core/Deleter.h"
+#include "Core/SPException.h"
+#include "Core/Assert.h"
+#include "Detail/MethodDescriptor.h"
+#include "Detail/FunctionObject.h"
+#include "Detail/InterpreterState.h"
+
+namespace sweetPy {
+
+    PyTypeObject& MethodDescriptor::get_type()
+    {
+        return InterpreterState::get().get_method_descriptor_type();
+    }
+
+    PyTypeObject MethodDescriptor::create_type()
+    {
+        static PyMemberDef members[] = {
+            {const_cast<char*>("__name__"), T_OBJECT, offsetof(DescriptorObject, m_name), READONLY, nullptr},
+            {const_cast<char*>("__doc__"), T_OBJECT, offsetof(DescriptorObject, m_doc), READONLY, nullptr},
+            {nullptr}
+        };
+        PyTypeObject type = {PyVarObject_HEAD_INIT(&PyType_Type, 0)};
+        type.tp_name = "sweetPy.method_descriptor";
+        type.tp_basicsize = sizeof(DescriptorObject);
+        type.tp_dealloc = &dealloc;
+        type.tp_traverse = &traverse;
+        type.tp_repr = &repr;
+        type.tp_call = &call;
+        type.tp_getattro = PyObject_GenericGetAttr;
+        type.tp_members = members;
+        type.tp_descr_get = &get;
+        type.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC;
+#ifdef SWEETPY_VECTORCALL_SUPPORT
+        type.tp_flags |= Py_TPFLAGS_METHOD_DESCRIPTOR | SWEETPY_TPFLAGS_HAVE_VECTORCALL;
+        type.tp_vectorcall_offset = offsetof(DescriptorObject, m_vectorcall);
+#endif
+        return type;
+    }
+
+    ObjectPtr MethodDescriptor::create(PyTypeObject* type, Function& function)
+    {
+        DescriptorObject* descriptor = PyObject_GC_New(DescriptorObject, &get_type());
+        CPYTHON_VERIFY(descriptor != nullptr, "Method descriptor allocation failed");
+#ifdef SWEETPY_VECTORCALL_SUPPORT
+        descriptor->m_vectorcall = &vectorcall;
+#endif
+        //Descriptors may outlive their type's dictionary, the type and so its functions are kept alive by them.
+        Py_INCREF(type);
+        descriptor->m_type = type;
+        descriptor->m_name = PyUnicode_InternFromString(function.get_name().c_str());
+        descriptor->m_doc = PyUnicode_FromString(function.get_doc().c_str());
+        descriptor->m_function = &function;
+        PyObject_GC_Track(descriptor);
+        return ObjectPtr(reinterpret_cast<PyObject*>(descriptor), &Deleter::Owner);
+    }
+
+    PyObject* MethodDescriptor::invoke(DescriptorObject& descriptor, PyObject* const* args, Py_ssize_t nargs)
+    {
+        if(nargs < 1 || !PyObject_TypeCheck(args[0], descriptor.m_type))
+        {
+            CPythonException(PyExc_TypeError, __CORE_SOURCE, "descriptor '%s' requires a '%s' instance",
+                             descriptor.m_function->get_name().c_str(), descriptor.m_type->tp_name).raise();
+            return NULL;
+        }
+        return descriptor.m_function->call(args[0], args + 1, nargs - 1);
+    }
+
+#ifdef SWEETPY_VECTORCALL_SUPPORT
+    PyObject* MethodDescriptor::vectorcall(PyObject* callable, PyObject* const* args, size_t nargsf, PyObject* kwnames)
+    {
+        auto& descriptor = *reinterpret_cast<DescriptorObject*>(callable);
+        if(kwnames != nullptr && PyTuple_GET_SIZE(kwnames) != 0)
+        {
+            CPythonException(PyExc_TypeError, __CORE_SOURCE, "%s() takes no keyword arguments",
+                             descriptor.m_function->get_name().c_str()).raise();
+            return NULL;
+        }
+        return invoke(descriptor, args, PyVectorcall_NARGS(nargsf));
+    }
+#endif
+
+    PyObject* MethodDescriptor::call(PyObject* callable, PyObject* args, PyObject* kwargs)
+    {
+        auto& descriptor = *reinterpret_cast<DescriptorObject*>(callable);
+        if(kwargs != nullptr && PyDict_GET_SIZE(kwargs) != 0)
+        {
+            CPythonException(PyExc_TypeError, __CORE_SOURCE, "%s() takes no keyword arguments",
+                             descriptor.m_function->get_name().c_str()).raise();
+            return NULL;
+        }
+        return invoke(descriptor, &PyTuple_GET_ITEM(args, 0), PyTuple_GET_SIZE(args));
+    }
+
+    PyObject* MethodDescriptor::get(PyObject* self, PyObject* object, PyObject* type)
+    {
+        //Accessed through the type itself.
+        if(object == nullptr)
+        {
+            Py_INCREF(self);
+            return self;
+        }
+        auto& descriptor = *reinterpret_cast<DescriptorObject*>(self);
+        if(!PyObject_TypeCheck(object, descriptor.m_type))
+        {
+            CPythonException(PyExc_TypeError, __CORE_SOURCE, "descriptor '%s' requires a '%s' instance",
+                             descriptor.m_function->get_name().c_str(), descriptor.m_type->tp_name).raise();
+            return NULL;
+        }
+        return FunctionObject::create(*descriptor.m_function, object).release();
+    }
+
+    PyObject* MethodDescriptor::repr(PyObject* self)
+    {
+        auto& descriptor = *reinterpret_cast<DescriptorObject*>(self);
+        return PyUnicode_FromFormat("<method '%U' of '%s' objects>", descriptor.m_name, descriptor.m_type->tp_name);
+    }
+
+    int MethodDescriptor::traverse(PyObject* self, visitproc visit, void* arg)
+    {
+        auto& descriptor = *reinterpret_cast<DescriptorObject*>(self);
+        Py_VISIT(descriptor.m_type);
+        return 0;
+    }
+
+    void MethodDescriptor::dealloc(PyObject* self)
+    {
+        PyObject_GC_UnTrack(self);
+        auto& descriptor = *reinterpret_cast<DescriptorObject*>(self);
+        Py_XDECREF(descriptor.m_name);
+        Py_XDECREF(descriptor.m_doc);
+        Py_XDECREF(descriptor.m_type);
+        PyObject_GC_Del(self);
+    }
+}
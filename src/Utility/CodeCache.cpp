@@ -0,0 +1,127 @@
+#include <Python.h>
+#include <marshal.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include "Utility/CodeCache.h"
+#include "Core/Assert.h"
+#include "Core/Deleter.h"
+
+namespace sweetPy
+{
+    CodeCache::CodeCache(const std::string& directory, int optimize)
+        :m_directory(directory), m_optimize(optimize), m_pythonMagic(static_cast<std::uint32_t>(PyImport_GetMagicNumber())),
+        m_hits(0), m_misses(0)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(m_directory, error);
+        CPYTHON_VERIFY(!error, "Code cache directory creation failed");
+    }
+
+    ObjectPtr CodeCache::compile(const std::string& source, const std::string& fileName, int start)
+    {
+        std::string key = create_key(source, fileName, start);
+        std::uint64_t keyHash = hash(key);
+        Header header = create_header(key, keyHash);
+        std::string path = get_path(keyHash);
+        ObjectPtr code = load(path, header, key);
+        if(code.get() != nullptr)
+        {
+            m_hits++;
+            return code;
+        }
+
+        m_misses++;
+        code.reset(Py_CompileStringExFlags(source.c_str(), fileName.c_str(), start, nullptr, m_optimize));
+        //The compilation's error remains pending, surfacing once the exception is raised.
+        if(code.get() == nullptr)
+            throw CPythonException(PyExc_SyntaxError, __CORE_SOURCE, "Compiling %s failed", fileName.c_str());
+        store(path, header, key, code.get());
+        return code;
+    }
+
+    std::string CodeCache::create_key(const std::string& source, const std::string& fileName, int start)
+    {
+        std::string key;
+        key.reserve(sizeof(start) + fileName.size() + 1 + source.size());
+        key.append(reinterpret_cast<const char*>(&start), sizeof(start));
+        key.append(fileName.c_str(), fileName.size() + 1);
+        key.append(source);
+        return key;
+    }
+
+    std::uint64_t CodeCache::hash(const std::string& key)
+    {
+        //FNV-1a, stable across processes and builds unlike std::hash, only names the entry's file.
+        std::uint64_t value = 14695981039346656037ULL;
+        for(char character : key)
+        {
+            value ^= static_cast<unsigned char>(character);
+            value *= 1099511628211ULL;
+        }
+        return value;
+    }
+
+    CodeCache::Header CodeCache::create_header(const std::string& key, std::uint64_t keyHash) const
+    {
+        return Header{MAGIC_WORD, m_pythonMagic, Py_MARSHAL_VERSION, m_optimize, keyHash, key.size()};
+    }
+
+    std::string CodeCache::get_path(std::uint64_t keyHash) const
+    {
+        char name[64];
+        std::snprintf(name, sizeof(name), "%016llx.%08x.o%d.spc", static_cast<unsigned long long>(keyHash), m_pythonMagic, m_optimize);
+        return (std::filesystem::path(m_directory) / name).string();
+    }
+
+    ObjectPtr CodeCache::load(const std::string& path, const Header& expected, const std::string& key) const
+    {
+        ObjectPtr code(nullptr, &Deleter::Owner);
+        std::ifstream file(path, std::ios::binary);
+        if(!file)
+            return code;
+        std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        //Entries of another configuration, of a colliding key or a truncated write are recompiled and overwritten.
+        std::size_t offset = sizeof(Header) + key.size();
+        if(content.size() <= offset || std::memcmp(content.data(), &expected, sizeof(Header)) != 0 ||
+           content.compare(sizeof(Header), key.size(), key) != 0)
+            return code;
+
+        code.reset(PyMarshal_ReadObjectFromString(content.data() + offset, content.size() - offset));
+        if(code.get() == nullptr || PyCode_Check(code.get()) == 0)
+        {
+            PyErr_Clear();
+            code.reset();
+        }
+        return code;
+    }
+
+    void CodeCache::store(const std::string& path, const Header& header, const std::string& key, PyObject* code) const
+    {
+        ObjectPtr data(PyMarshal_WriteObjectToString(code, Py_MARSHAL_VERSION), &Deleter::Owner);
+        //A failure to store only costs a later compilation.
+        if(data.get() == nullptr)
+        {
+            PyErr_Clear();
+            return;
+        }
+        std::string temporaryPath = path + "." + std::to_string(::getpid()) + ".tmp";
+        {
+            std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+            file.write(key.data(), key.size());
+            file.write(PyBytes_AS_STRING(data.get()), PyBytes_GET_SIZE(data.get()));
+            if(!file)
+            {
+                file.close();
+                std::remove(temporaryPath.c_str());
+                return;
+            }
+        }
+        if(std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+            std::remove(temporaryPath.c_str());
+    }
+}